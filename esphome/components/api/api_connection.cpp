@@ -27,6 +27,10 @@ namespace api {
 
 static const char *const TAG = "api.connection";
 static const int ESP32_CAMERA_STOP_STREAM = 5000;
+// Stop adding state responses to a batch once it is about the size of one TCP segment
+static const size_t MAX_STATE_BATCH_SIZE = 1360;
+// Binary sensor edges are queued one by one, past this many pending states they are merged as well
+static const size_t MAX_DIRTY_STATES = 256;
 
 APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *parent)
     : parent_(parent), initial_state_iterator_(this), list_entities_iterator_(this) {
@@ -111,13 +115,14 @@ void APIConnection::loop() {
   } else {
     this->last_traffic_ = millis();
     // read a packet
-    this->read_message(buffer.data_len, buffer.type, &buffer.container[buffer.data_offset]);
+    this->read_message(buffer.data_len, buffer.type, buffer.data);
     if (this->remove_)
       return;
   }
 
   this->list_entities_iterator_.advance();
   this->initial_state_iterator_.advance();
+  this->process_dirty_states_();
 
   static uint32_t keepalive = 60000;
   static uint8_t max_ping_retries = 60;
@@ -152,7 +157,11 @@ void APIConnection::loop() {
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available() && this->helper_->can_write_without_blocking()) {
     uint32_t to_send = std::min((size_t) 1024, this->image_reader_.available());
-    auto buffer = this->create_buffer();
+    uint32_t msg_size = 0;
+    ProtoSize::add_fixed32_field(msg_size, 1, esp32_camera::global_esp32_camera->get_object_id_hash());
+    ProtoSize::add_string_field(msg_size, 1, to_send);
+    ProtoSize::add_bool_field(msg_size, 1, true);
+    auto buffer = this->create_buffer(msg_size);
     // fixed32 key = 1;
     buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
     // bytes data = 2;
@@ -188,8 +197,9 @@ void APIConnection::loop() {
   }
 }
 
-std::string get_default_unique_id(const std::string &component_type, EntityBase *entity) {
-  return App.get_name() + component_type + entity->get_object_id();
+StringRef APIConnection::default_unique_id_ref_(const char *component_type, const StringRef &object_id) {
+  this->unique_id_buf_.assign(App.get_name()).append(component_type).append(object_id.c_str(), object_id.size());
+  return StringRef(this->unique_id_buf_);
 }
 
 DisconnectResponse APIConnection::disconnect(const DisconnectRequest &msg) {
@@ -207,26 +217,41 @@ void APIConnection::on_disconnect_response(const DisconnectResponse &value) {
 
 #ifdef USE_BINARY_SENSOR
 bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor, bool state) {
-  if (!this->state_subscription_)
-    return false;
-
+  if (!binary_sensor->has_state())
+    return this->schedule_state_(binary_sensor, &APIConnection::try_send_binary_sensor_state_);
+  // Queue the state itself, a short ON -> OFF pulse must not be merged into its final state
+  return this->schedule_state_(binary_sensor, state ? &APIConnection::try_send_binary_sensor_on_
+                                                    : &APIConnection::try_send_binary_sensor_off_);
+}
+bool APIConnection::try_send_binary_sensor_state_(EntityBase *entity) {
+  auto *binary_sensor = static_cast<binary_sensor::BinarySensor *>(entity);
+  return this->send_binary_sensor_value_(binary_sensor, binary_sensor->state, !binary_sensor->has_state());
+}
+bool APIConnection::try_send_binary_sensor_on_(EntityBase *entity) {
+  return this->send_binary_sensor_value_(static_cast<binary_sensor::BinarySensor *>(entity), true, false);
+}
+bool APIConnection::try_send_binary_sensor_off_(EntityBase *entity) {
+  return this->send_binary_sensor_value_(static_cast<binary_sensor::BinarySensor *>(entity), false, false);
+}
+bool APIConnection::send_binary_sensor_value_(binary_sensor::BinarySensor *binary_sensor, bool state,
+                                              bool missing_state) {
   BinarySensorStateResponse resp;
   resp.key = binary_sensor->get_object_id_hash();
   resp.state = state;
-  resp.missing_state = !binary_sensor->has_state();
+  resp.missing_state = missing_state;
   return this->send_binary_sensor_state_response(resp);
 }
 bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_sensor) {
   ListEntitiesBinarySensorResponse msg;
-  msg.object_id = binary_sensor->get_object_id();
+  msg.object_id = binary_sensor->get_object_id_ref(this->object_id_buf_);
   msg.key = binary_sensor->get_object_id_hash();
   if (binary_sensor->has_own_name())
     msg.name = binary_sensor->get_name();
-  msg.unique_id = get_default_unique_id("binary_sensor", binary_sensor);
-  msg.device_class = binary_sensor->get_device_class();
+  msg.unique_id = this->default_unique_id_ref_("binary_sensor", msg.object_id);
+  msg.device_class = binary_sensor->get_device_class_ref();
   msg.is_status_binary_sensor = binary_sensor->is_status_binary_sensor();
   msg.disabled_by_default = binary_sensor->is_disabled_by_default();
-  msg.icon = binary_sensor->get_icon();
+  msg.icon = binary_sensor->get_icon_ref();
   msg.entity_category = static_cast<enums::EntityCategory>(binary_sensor->get_entity_category());
   return this->send_list_entities_binary_sensor_response(msg);
 }
@@ -234,9 +259,10 @@ bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_
 
 #ifdef USE_COVER
 bool APIConnection::send_cover_state(cover::Cover *cover) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(cover, &APIConnection::try_send_cover_state_);
+}
+bool APIConnection::try_send_cover_state_(EntityBase *entity) {
+  auto *cover = static_cast<cover::Cover *>(entity);
   auto traits = cover->get_traits();
   CoverStateResponse resp{};
   resp.key = cover->get_object_id_hash();
@@ -252,17 +278,17 @@ bool APIConnection::send_cover_info(cover::Cover *cover) {
   auto traits = cover->get_traits();
   ListEntitiesCoverResponse msg;
   msg.key = cover->get_object_id_hash();
-  msg.object_id = cover->get_object_id();
+  msg.object_id = cover->get_object_id_ref(this->object_id_buf_);
   if (cover->has_own_name())
     msg.name = cover->get_name();
-  msg.unique_id = get_default_unique_id("cover", cover);
+  msg.unique_id = this->default_unique_id_ref_("cover", msg.object_id);
   msg.assumed_state = traits.get_is_assumed_state();
   msg.supports_position = traits.get_supports_position();
   msg.supports_tilt = traits.get_supports_tilt();
   msg.supports_stop = traits.get_supports_stop();
-  msg.device_class = cover->get_device_class();
+  msg.device_class = cover->get_device_class_ref();
   msg.disabled_by_default = cover->is_disabled_by_default();
-  msg.icon = cover->get_icon();
+  msg.icon = cover->get_icon_ref();
   msg.entity_category = static_cast<enums::EntityCategory>(cover->get_entity_category());
   return this->send_list_entities_cover_response(msg);
 }
@@ -297,9 +323,10 @@ void APIConnection::cover_command(const CoverCommandRequest &msg) {
 
 #ifdef USE_FAN
 bool APIConnection::send_fan_state(fan::Fan *fan) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(fan, &APIConnection::try_send_fan_state_);
+}
+bool APIConnection::try_send_fan_state_(EntityBase *entity) {
+  auto *fan = static_cast<fan::Fan *>(entity);
   auto traits = fan->get_traits();
   FanStateResponse resp{};
   resp.key = fan->get_object_id_hash();
@@ -319,10 +346,10 @@ bool APIConnection::send_fan_info(fan::Fan *fan) {
   auto traits = fan->get_traits();
   ListEntitiesFanResponse msg;
   msg.key = fan->get_object_id_hash();
-  msg.object_id = fan->get_object_id();
+  msg.object_id = fan->get_object_id_ref(this->object_id_buf_);
   if (fan->has_own_name())
     msg.name = fan->get_name();
-  msg.unique_id = get_default_unique_id("fan", fan);
+  msg.unique_id = this->default_unique_id_ref_("fan", msg.object_id);
   msg.supports_oscillation = traits.supports_oscillation();
   msg.supports_speed = traits.supports_speed();
   msg.supports_direction = traits.supports_direction();
@@ -330,7 +357,7 @@ bool APIConnection::send_fan_info(fan::Fan *fan) {
   for (auto const &preset : traits.supported_preset_modes())
     msg.supported_preset_modes.push_back(preset);
   msg.disabled_by_default = fan->is_disabled_by_default();
-  msg.icon = fan->get_icon();
+  msg.icon = fan->get_icon_ref();
   msg.entity_category = static_cast<enums::EntityCategory>(fan->get_entity_category());
   return this->send_list_entities_fan_response(msg);
 }
@@ -358,9 +385,10 @@ void APIConnection::fan_command(const FanCommandRequest &msg) {
 
 #ifdef USE_LIGHT
 bool APIConnection::send_light_state(light::LightState *light) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(light, &APIConnection::try_send_light_state_);
+}
+bool APIConnection::try_send_light_state_(EntityBase *entity) {
+  auto *light = static_cast<light::LightState *>(entity);
   auto traits = light->get_traits();
   auto values = light->remote_values;
   auto color_mode = values.get_color_mode();
@@ -386,13 +414,13 @@ bool APIConnection::send_light_info(light::LightState *light) {
   auto traits = light->get_traits();
   ListEntitiesLightResponse msg;
   msg.key = light->get_object_id_hash();
-  msg.object_id = light->get_object_id();
+  msg.object_id = light->get_object_id_ref(this->object_id_buf_);
   if (light->has_own_name())
     msg.name = light->get_name();
-  msg.unique_id = get_default_unique_id("light", light);
+  msg.unique_id = this->default_unique_id_ref_("light", msg.object_id);
 
   msg.disabled_by_default = light->is_disabled_by_default();
-  msg.icon = light->get_icon();
+  msg.icon = light->get_icon_ref();
   msg.entity_category = static_cast<enums::EntityCategory>(light->get_entity_category());
 
   for (auto mode : traits.get_supported_color_modes())
@@ -456,29 +484,33 @@ void APIConnection::light_command(const LightCommandRequest &msg) {
 
 #ifdef USE_SENSOR
 bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(sensor, &APIConnection::try_send_sensor_state_);
+}
+bool APIConnection::try_send_sensor_state_(EntityBase *entity) {
+  auto *sensor = static_cast<sensor::Sensor *>(entity);
   SensorStateResponse resp{};
   resp.key = sensor->get_object_id_hash();
-  resp.state = state;
+  resp.state = sensor->state;
   resp.missing_state = !sensor->has_state();
   return this->send_sensor_state_response(resp);
 }
 bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
   ListEntitiesSensorResponse msg;
   msg.key = sensor->get_object_id_hash();
-  msg.object_id = sensor->get_object_id();
+  msg.object_id = sensor->get_object_id_ref(this->object_id_buf_);
   if (sensor->has_own_name())
     msg.name = sensor->get_name();
-  msg.unique_id = sensor->unique_id();
-  if (msg.unique_id.empty())
-    msg.unique_id = get_default_unique_id("sensor", sensor);
-  msg.icon = sensor->get_icon();
-  msg.unit_of_measurement = sensor->get_unit_of_measurement();
+  this->unique_id_buf_ = sensor->unique_id();
+  if (this->unique_id_buf_.empty()) {
+    msg.unique_id = this->default_unique_id_ref_("sensor", msg.object_id);
+  } else {
+    msg.unique_id = StringRef(this->unique_id_buf_);
+  }
+  msg.icon = sensor->get_icon_ref();
+  msg.unit_of_measurement = sensor->get_unit_of_measurement_ref();
   msg.accuracy_decimals = sensor->get_accuracy_decimals();
   msg.force_update = sensor->get_force_update();
-  msg.device_class = sensor->get_device_class();
+  msg.device_class = sensor->get_device_class_ref();
   msg.state_class = static_cast<enums::SensorStateClass>(sensor->get_state_class());
   msg.disabled_by_default = sensor->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(sensor->get_entity_category());
@@ -488,26 +520,27 @@ bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
 
 #ifdef USE_SWITCH
 bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(a_switch, &APIConnection::try_send_switch_state_);
+}
+bool APIConnection::try_send_switch_state_(EntityBase *entity) {
+  auto *a_switch = static_cast<switch_::Switch *>(entity);
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
-  resp.state = state;
+  resp.state = a_switch->state;
   return this->send_switch_state_response(resp);
 }
 bool APIConnection::send_switch_info(switch_::Switch *a_switch) {
   ListEntitiesSwitchResponse msg;
   msg.key = a_switch->get_object_id_hash();
-  msg.object_id = a_switch->get_object_id();
+  msg.object_id = a_switch->get_object_id_ref(this->object_id_buf_);
   if (a_switch->has_own_name())
     msg.name = a_switch->get_name();
-  msg.unique_id = get_default_unique_id("switch", a_switch);
-  msg.icon = a_switch->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("switch", msg.object_id);
+  msg.icon = a_switch->get_icon_ref();
   msg.assumed_state = a_switch->assumed_state();
   msg.disabled_by_default = a_switch->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(a_switch->get_entity_category());
-  msg.device_class = a_switch->get_device_class();
+  msg.device_class = a_switch->get_device_class_ref();
   return this->send_list_entities_switch_response(msg);
 }
 void APIConnection::switch_command(const SwitchCommandRequest &msg) {
@@ -525,36 +558,41 @@ void APIConnection::switch_command(const SwitchCommandRequest &msg) {
 
 #ifdef USE_TEXT_SENSOR
 bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(text_sensor, &APIConnection::try_send_text_sensor_state_);
+}
+bool APIConnection::try_send_text_sensor_state_(EntityBase *entity) {
+  auto *text_sensor = static_cast<text_sensor::TextSensor *>(entity);
   TextSensorStateResponse resp{};
   resp.key = text_sensor->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = text_sensor->state;
   resp.missing_state = !text_sensor->has_state();
   return this->send_text_sensor_state_response(resp);
 }
 bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor) {
   ListEntitiesTextSensorResponse msg;
   msg.key = text_sensor->get_object_id_hash();
-  msg.object_id = text_sensor->get_object_id();
+  msg.object_id = text_sensor->get_object_id_ref(this->object_id_buf_);
   msg.name = text_sensor->get_name();
-  msg.unique_id = text_sensor->unique_id();
-  if (msg.unique_id.empty())
-    msg.unique_id = get_default_unique_id("text_sensor", text_sensor);
-  msg.icon = text_sensor->get_icon();
+  this->unique_id_buf_ = text_sensor->unique_id();
+  if (this->unique_id_buf_.empty()) {
+    msg.unique_id = this->default_unique_id_ref_("text_sensor", msg.object_id);
+  } else {
+    msg.unique_id = StringRef(this->unique_id_buf_);
+  }
+  msg.icon = text_sensor->get_icon_ref();
   msg.disabled_by_default = text_sensor->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(text_sensor->get_entity_category());
-  msg.device_class = text_sensor->get_device_class();
+  msg.device_class = text_sensor->get_device_class_ref();
   return this->send_list_entities_text_sensor_response(msg);
 }
 #endif
 
 #ifdef USE_CLIMATE
 bool APIConnection::send_climate_state(climate::Climate *climate) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(climate, &APIConnection::try_send_climate_state_);
+}
+bool APIConnection::try_send_climate_state_(EntityBase *entity) {
+  auto *climate = static_cast<climate::Climate *>(entity);
   auto traits = climate->get_traits();
   ClimateStateResponse resp{};
   resp.key = climate->get_object_id_hash();
@@ -589,13 +627,13 @@ bool APIConnection::send_climate_info(climate::Climate *climate) {
   auto traits = climate->get_traits();
   ListEntitiesClimateResponse msg;
   msg.key = climate->get_object_id_hash();
-  msg.object_id = climate->get_object_id();
+  msg.object_id = climate->get_object_id_ref(this->object_id_buf_);
   if (climate->has_own_name())
     msg.name = climate->get_name();
-  msg.unique_id = get_default_unique_id("climate", climate);
+  msg.unique_id = this->default_unique_id_ref_("climate", msg.object_id);
 
   msg.disabled_by_default = climate->is_disabled_by_default();
-  msg.icon = climate->get_icon();
+  msg.icon = climate->get_icon_ref();
   msg.entity_category = static_cast<enums::EntityCategory>(climate->get_entity_category());
 
   msg.supports_current_temperature = traits.get_supports_current_temperature();
@@ -660,28 +698,29 @@ void APIConnection::climate_command(const ClimateCommandRequest &msg) {
 
 #ifdef USE_NUMBER
 bool APIConnection::send_number_state(number::Number *number, float state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(number, &APIConnection::try_send_number_state_);
+}
+bool APIConnection::try_send_number_state_(EntityBase *entity) {
+  auto *number = static_cast<number::Number *>(entity);
   NumberStateResponse resp{};
   resp.key = number->get_object_id_hash();
-  resp.state = state;
+  resp.state = number->state;
   resp.missing_state = !number->has_state();
   return this->send_number_state_response(resp);
 }
 bool APIConnection::send_number_info(number::Number *number) {
   ListEntitiesNumberResponse msg;
   msg.key = number->get_object_id_hash();
-  msg.object_id = number->get_object_id();
+  msg.object_id = number->get_object_id_ref(this->object_id_buf_);
   if (number->has_own_name())
     msg.name = number->get_name();
-  msg.unique_id = get_default_unique_id("number", number);
-  msg.icon = number->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("number", msg.object_id);
+  msg.icon = number->get_icon_ref();
   msg.disabled_by_default = number->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(number->get_entity_category());
-  msg.unit_of_measurement = number->traits.get_unit_of_measurement();
+  msg.unit_of_measurement = number->traits.get_unit_of_measurement_ref();
   msg.mode = static_cast<enums::NumberMode>(number->traits.get_mode());
-  msg.device_class = number->traits.get_device_class();
+  msg.device_class = number->traits.get_device_class_ref();
 
   msg.min_value = number->traits.get_min_value();
   msg.max_value = number->traits.get_max_value();
@@ -702,9 +741,10 @@ void APIConnection::number_command(const NumberCommandRequest &msg) {
 
 #ifdef USE_DATETIME_DATE
 bool APIConnection::send_date_state(datetime::DateEntity *date) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(date, &APIConnection::try_send_date_state_);
+}
+bool APIConnection::try_send_date_state_(EntityBase *entity) {
+  auto *date = static_cast<datetime::DateEntity *>(entity);
   DateStateResponse resp{};
   resp.key = date->get_object_id_hash();
   resp.missing_state = !date->has_state();
@@ -716,11 +756,11 @@ bool APIConnection::send_date_state(datetime::DateEntity *date) {
 bool APIConnection::send_date_info(datetime::DateEntity *date) {
   ListEntitiesDateResponse msg;
   msg.key = date->get_object_id_hash();
-  msg.object_id = date->get_object_id();
+  msg.object_id = date->get_object_id_ref(this->object_id_buf_);
   if (date->has_own_name())
     msg.name = date->get_name();
-  msg.unique_id = get_default_unique_id("date", date);
-  msg.icon = date->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("date", msg.object_id);
+  msg.icon = date->get_icon_ref();
   msg.disabled_by_default = date->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(date->get_entity_category());
 
@@ -739,9 +779,10 @@ void APIConnection::date_command(const DateCommandRequest &msg) {
 
 #ifdef USE_DATETIME_TIME
 bool APIConnection::send_time_state(datetime::TimeEntity *time) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(time, &APIConnection::try_send_time_state_);
+}
+bool APIConnection::try_send_time_state_(EntityBase *entity) {
+  auto *time = static_cast<datetime::TimeEntity *>(entity);
   TimeStateResponse resp{};
   resp.key = time->get_object_id_hash();
   resp.missing_state = !time->has_state();
@@ -753,11 +794,11 @@ bool APIConnection::send_time_state(datetime::TimeEntity *time) {
 bool APIConnection::send_time_info(datetime::TimeEntity *time) {
   ListEntitiesTimeResponse msg;
   msg.key = time->get_object_id_hash();
-  msg.object_id = time->get_object_id();
+  msg.object_id = time->get_object_id_ref(this->object_id_buf_);
   if (time->has_own_name())
     msg.name = time->get_name();
-  msg.unique_id = get_default_unique_id("time", time);
-  msg.icon = time->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("time", msg.object_id);
+  msg.icon = time->get_icon_ref();
   msg.disabled_by_default = time->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(time->get_entity_category());
 
@@ -776,9 +817,10 @@ void APIConnection::time_command(const TimeCommandRequest &msg) {
 
 #ifdef USE_DATETIME_DATETIME
 bool APIConnection::send_datetime_state(datetime::DateTimeEntity *datetime) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(datetime, &APIConnection::try_send_datetime_state_);
+}
+bool APIConnection::try_send_datetime_state_(EntityBase *entity) {
+  auto *datetime = static_cast<datetime::DateTimeEntity *>(entity);
   DateTimeStateResponse resp{};
   resp.key = datetime->get_object_id_hash();
   resp.missing_state = !datetime->has_state();
@@ -791,11 +833,11 @@ bool APIConnection::send_datetime_state(datetime::DateTimeEntity *datetime) {
 bool APIConnection::send_datetime_info(datetime::DateTimeEntity *datetime) {
   ListEntitiesDateTimeResponse msg;
   msg.key = datetime->get_object_id_hash();
-  msg.object_id = datetime->get_object_id();
+  msg.object_id = datetime->get_object_id_ref(this->object_id_buf_);
   if (datetime->has_own_name())
     msg.name = datetime->get_name();
-  msg.unique_id = get_default_unique_id("datetime", datetime);
-  msg.icon = datetime->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("datetime", msg.object_id);
+  msg.icon = datetime->get_icon_ref();
   msg.disabled_by_default = datetime->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(datetime->get_entity_category());
 
@@ -814,28 +856,29 @@ void APIConnection::datetime_command(const DateTimeCommandRequest &msg) {
 
 #ifdef USE_TEXT
 bool APIConnection::send_text_state(text::Text *text, std::string state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(text, &APIConnection::try_send_text_state_);
+}
+bool APIConnection::try_send_text_state_(EntityBase *entity) {
+  auto *text = static_cast<text::Text *>(entity);
   TextStateResponse resp{};
   resp.key = text->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = text->state;
   resp.missing_state = !text->has_state();
   return this->send_text_state_response(resp);
 }
 bool APIConnection::send_text_info(text::Text *text) {
   ListEntitiesTextResponse msg;
   msg.key = text->get_object_id_hash();
-  msg.object_id = text->get_object_id();
+  msg.object_id = text->get_object_id_ref(this->object_id_buf_);
   msg.name = text->get_name();
-  msg.icon = text->get_icon();
+  msg.icon = text->get_icon_ref();
   msg.disabled_by_default = text->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(text->get_entity_category());
   msg.mode = static_cast<enums::TextMode>(text->traits.get_mode());
 
   msg.min_length = text->traits.get_min_length();
   msg.max_length = text->traits.get_max_length();
-  msg.pattern = text->traits.get_pattern();
+  msg.pattern = StringRef(text->traits.get_pattern());
 
   return this->send_list_entities_text_response(msg);
 }
@@ -852,23 +895,24 @@ void APIConnection::text_command(const TextCommandRequest &msg) {
 
 #ifdef USE_SELECT
 bool APIConnection::send_select_state(select::Select *select, std::string state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(select, &APIConnection::try_send_select_state_);
+}
+bool APIConnection::try_send_select_state_(EntityBase *entity) {
+  auto *select = static_cast<select::Select *>(entity);
   SelectStateResponse resp{};
   resp.key = select->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = select->state;
   resp.missing_state = !select->has_state();
   return this->send_select_state_response(resp);
 }
 bool APIConnection::send_select_info(select::Select *select) {
   ListEntitiesSelectResponse msg;
   msg.key = select->get_object_id_hash();
-  msg.object_id = select->get_object_id();
+  msg.object_id = select->get_object_id_ref(this->object_id_buf_);
   if (select->has_own_name())
     msg.name = select->get_name();
-  msg.unique_id = get_default_unique_id("select", select);
-  msg.icon = select->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("select", msg.object_id);
+  msg.icon = select->get_icon_ref();
   msg.disabled_by_default = select->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(select->get_entity_category());
 
@@ -892,14 +936,14 @@ void APIConnection::select_command(const SelectCommandRequest &msg) {
 bool APIConnection::send_button_info(button::Button *button) {
   ListEntitiesButtonResponse msg;
   msg.key = button->get_object_id_hash();
-  msg.object_id = button->get_object_id();
+  msg.object_id = button->get_object_id_ref(this->object_id_buf_);
   if (button->has_own_name())
     msg.name = button->get_name();
-  msg.unique_id = get_default_unique_id("button", button);
-  msg.icon = button->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("button", msg.object_id);
+  msg.icon = button->get_icon_ref();
   msg.disabled_by_default = button->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(button->get_entity_category());
-  msg.device_class = button->get_device_class();
+  msg.device_class = button->get_device_class_ref();
   return this->send_list_entities_button_response(msg);
 }
 void APIConnection::button_command(const ButtonCommandRequest &msg) {
@@ -913,22 +957,23 @@ void APIConnection::button_command(const ButtonCommandRequest &msg) {
 
 #ifdef USE_LOCK
 bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(a_lock, &APIConnection::try_send_lock_state_);
+}
+bool APIConnection::try_send_lock_state_(EntityBase *entity) {
+  auto *a_lock = static_cast<lock::Lock *>(entity);
   LockStateResponse resp{};
   resp.key = a_lock->get_object_id_hash();
-  resp.state = static_cast<enums::LockState>(state);
+  resp.state = static_cast<enums::LockState>(a_lock->state);
   return this->send_lock_state_response(resp);
 }
 bool APIConnection::send_lock_info(lock::Lock *a_lock) {
   ListEntitiesLockResponse msg;
   msg.key = a_lock->get_object_id_hash();
-  msg.object_id = a_lock->get_object_id();
+  msg.object_id = a_lock->get_object_id_ref(this->object_id_buf_);
   if (a_lock->has_own_name())
     msg.name = a_lock->get_name();
-  msg.unique_id = get_default_unique_id("lock", a_lock);
-  msg.icon = a_lock->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("lock", msg.object_id);
+  msg.icon = a_lock->get_icon_ref();
   msg.assumed_state = a_lock->traits.get_assumed_state();
   msg.disabled_by_default = a_lock->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(a_lock->get_entity_category());
@@ -957,9 +1002,10 @@ void APIConnection::lock_command(const LockCommandRequest &msg) {
 
 #ifdef USE_VALVE
 bool APIConnection::send_valve_state(valve::Valve *valve) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(valve, &APIConnection::try_send_valve_state_);
+}
+bool APIConnection::try_send_valve_state_(EntityBase *entity) {
+  auto *valve = static_cast<valve::Valve *>(entity);
   ValveStateResponse resp{};
   resp.key = valve->get_object_id_hash();
   resp.position = valve->position;
@@ -970,14 +1016,14 @@ bool APIConnection::send_valve_info(valve::Valve *valve) {
   auto traits = valve->get_traits();
   ListEntitiesValveResponse msg;
   msg.key = valve->get_object_id_hash();
-  msg.object_id = valve->get_object_id();
+  msg.object_id = valve->get_object_id_ref(this->object_id_buf_);
   if (valve->has_own_name())
     msg.name = valve->get_name();
-  msg.unique_id = get_default_unique_id("valve", valve);
-  msg.icon = valve->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("valve", msg.object_id);
+  msg.icon = valve->get_icon_ref();
   msg.disabled_by_default = valve->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(valve->get_entity_category());
-  msg.device_class = valve->get_device_class();
+  msg.device_class = valve->get_device_class_ref();
   msg.assumed_state = traits.get_is_assumed_state();
   msg.supports_position = traits.get_supports_position();
   msg.supports_stop = traits.get_supports_stop();
@@ -999,9 +1045,10 @@ void APIConnection::valve_command(const ValveCommandRequest &msg) {
 
 #ifdef USE_MEDIA_PLAYER
 bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_player) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(media_player, &APIConnection::try_send_media_player_state_);
+}
+bool APIConnection::try_send_media_player_state_(EntityBase *entity) {
+  auto *media_player = static_cast<media_player::MediaPlayer *>(entity);
   MediaPlayerStateResponse resp{};
   resp.key = media_player->get_object_id_hash();
 
@@ -1016,11 +1063,11 @@ bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_pla
 bool APIConnection::send_media_player_info(media_player::MediaPlayer *media_player) {
   ListEntitiesMediaPlayerResponse msg;
   msg.key = media_player->get_object_id_hash();
-  msg.object_id = media_player->get_object_id();
+  msg.object_id = media_player->get_object_id_ref(this->object_id_buf_);
   if (media_player->has_own_name())
     msg.name = media_player->get_name();
-  msg.unique_id = get_default_unique_id("media_player", media_player);
-  msg.icon = media_player->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("media_player", msg.object_id);
+  msg.icon = media_player->get_icon_ref();
   msg.disabled_by_default = media_player->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(media_player->get_entity_category());
 
@@ -1074,12 +1121,12 @@ void APIConnection::send_camera_state(std::shared_ptr<esp32_camera::CameraImage>
 bool APIConnection::send_camera_info(esp32_camera::ESP32Camera *camera) {
   ListEntitiesCameraResponse msg;
   msg.key = camera->get_object_id_hash();
-  msg.object_id = camera->get_object_id();
+  msg.object_id = camera->get_object_id_ref(this->object_id_buf_);
   if (camera->has_own_name())
     msg.name = camera->get_name();
-  msg.unique_id = get_default_unique_id("camera", camera);
+  msg.unique_id = this->default_unique_id_ref_("camera", msg.object_id);
   msg.disabled_by_default = camera->is_disabled_by_default();
-  msg.icon = camera->get_icon();
+  msg.icon = camera->get_icon_ref();
   msg.entity_category = static_cast<enums::EntityCategory>(camera->get_entity_category());
   return this->send_list_entities_camera_response(msg);
 }
@@ -1265,9 +1312,10 @@ void APIConnection::voice_assistant_set_configuration(const VoiceAssistantSetCon
 
 #ifdef USE_ALARM_CONTROL_PANEL
 bool APIConnection::send_alarm_control_panel_state(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(a_alarm_control_panel, &APIConnection::try_send_alarm_control_panel_state_);
+}
+bool APIConnection::try_send_alarm_control_panel_state_(EntityBase *entity) {
+  auto *a_alarm_control_panel = static_cast<alarm_control_panel::AlarmControlPanel *>(entity);
   AlarmControlPanelStateResponse resp{};
   resp.key = a_alarm_control_panel->get_object_id_hash();
   resp.state = static_cast<enums::AlarmControlPanelState>(a_alarm_control_panel->get_state());
@@ -1276,10 +1324,10 @@ bool APIConnection::send_alarm_control_panel_state(alarm_control_panel::AlarmCon
 bool APIConnection::send_alarm_control_panel_info(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
   ListEntitiesAlarmControlPanelResponse msg;
   msg.key = a_alarm_control_panel->get_object_id_hash();
-  msg.object_id = a_alarm_control_panel->get_object_id();
+  msg.object_id = a_alarm_control_panel->get_object_id_ref(this->object_id_buf_);
   msg.name = a_alarm_control_panel->get_name();
-  msg.unique_id = get_default_unique_id("alarm_control_panel", a_alarm_control_panel);
-  msg.icon = a_alarm_control_panel->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("alarm_control_panel", msg.object_id);
+  msg.icon = a_alarm_control_panel->get_icon_ref();
   msg.disabled_by_default = a_alarm_control_panel->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(a_alarm_control_panel->get_entity_category());
   msg.supported_features = a_alarm_control_panel->get_supported_features();
@@ -1331,14 +1379,14 @@ bool APIConnection::send_event(event::Event *event, std::string event_type) {
 bool APIConnection::send_event_info(event::Event *event) {
   ListEntitiesEventResponse msg;
   msg.key = event->get_object_id_hash();
-  msg.object_id = event->get_object_id();
+  msg.object_id = event->get_object_id_ref(this->object_id_buf_);
   if (event->has_own_name())
     msg.name = event->get_name();
-  msg.unique_id = get_default_unique_id("event", event);
-  msg.icon = event->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("event", msg.object_id);
+  msg.icon = event->get_icon_ref();
   msg.disabled_by_default = event->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(event->get_entity_category());
-  msg.device_class = event->get_device_class();
+  msg.device_class = event->get_device_class_ref();
   for (const auto &event_type : event->get_event_types())
     msg.event_types.push_back(event_type);
   return this->send_list_entities_event_response(msg);
@@ -1347,9 +1395,10 @@ bool APIConnection::send_event_info(event::Event *event) {
 
 #ifdef USE_UPDATE
 bool APIConnection::send_update_state(update::UpdateEntity *update) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_(update, &APIConnection::try_send_update_state_);
+}
+bool APIConnection::try_send_update_state_(EntityBase *entity) {
+  auto *update = static_cast<update::UpdateEntity *>(entity);
   UpdateStateResponse resp{};
   resp.key = update->get_object_id_hash();
   resp.missing_state = !update->has_state();
@@ -1371,14 +1420,14 @@ bool APIConnection::send_update_state(update::UpdateEntity *update) {
 bool APIConnection::send_update_info(update::UpdateEntity *update) {
   ListEntitiesUpdateResponse msg;
   msg.key = update->get_object_id_hash();
-  msg.object_id = update->get_object_id();
+  msg.object_id = update->get_object_id_ref(this->object_id_buf_);
   if (update->has_own_name())
     msg.name = update->get_name();
-  msg.unique_id = get_default_unique_id("update", update);
-  msg.icon = update->get_icon();
+  msg.unique_id = this->default_unique_id_ref_("update", msg.object_id);
+  msg.icon = update->get_icon_ref();
   msg.disabled_by_default = update->is_disabled_by_default();
   msg.entity_category = static_cast<enums::EntityCategory>(update->get_entity_category());
-  msg.device_class = update->get_device_class();
+  msg.device_class = update->get_device_class_ref();
   return this->send_list_entities_update_response(msg);
 }
 void APIConnection::update_command(const UpdateCommandRequest &msg) {
@@ -1408,11 +1457,15 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
     return false;
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  const size_t line_len = strlen(line);
+  uint32_t msg_size = 0;
+  ProtoSize::add_uint32_field(msg_size, 1, static_cast<uint32_t>(level));
+  ProtoSize::add_string_field(msg_size, 1, line_len);
+  auto buffer = this->create_buffer(msg_size);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_len);
   // SubscribeLogsResponse - 29
   return this->send_buffer(buffer, 29);
 }
@@ -1460,6 +1513,7 @@ DeviceInfoResponse APIConnection::device_info(const DeviceInfoRequest &msg) {
   resp.name = App.get_name();
   resp.friendly_name = App.get_friendly_name();
   resp.suggested_area = App.get_area();
+  resp.entities_hash = this->parent_->get_entities_hash();
   resp.mac_address = get_mac_address_pretty();
   resp.esphome_version = ESPHOME_VERSION;
   resp.compilation_time = App.get_compilation_time();
@@ -1495,6 +1549,38 @@ DeviceInfoResponse APIConnection::device_info(const DeviceInfoRequest &msg) {
 #endif
   return resp;
 }
+#ifdef USE_PROFILER
+static ProfileTiming profile_timing(const esphome::ProfileStats &stats) {
+  ProfileTiming timing;
+  timing.call_count = stats.count;
+  timing.total_us = stats.total_us;
+  timing.max_us = stats.max_us;
+  timing.p99_us = stats.p99_us();
+  return timing;
+}
+ComponentProfileResponse APIConnection::component_profile(const ComponentProfileRequest &msg) {
+  ComponentProfileResponse resp;
+  for (const auto &entry : App.profiler.get_components()) {
+    ComponentLoopProfile profile;
+    profile.source = entry.component->get_component_source();
+    profile.setup_us = entry.setup_us;
+    profile.loop = profile_timing(entry.loop);
+    resp.components.push_back(std::move(profile));
+  }
+  for (const auto &entry : App.profiler.get_scheduler_items()) {
+    SchedulerItemProfile profile;
+    profile.source = entry.component == nullptr ? "<null>" : entry.component->get_component_source();
+    profile.name = entry.get_display_name();
+    profile.name_hash = entry.name_hash;
+    profile.stats = profile_timing(entry.stats);
+    resp.scheduler_items.push_back(std::move(profile));
+  }
+  resp.dropped_scheduler_items = App.profiler.get_dropped_scheduler_items();
+  if (msg.reset)
+    App.profiler.reset();
+  return resp;
+}
+#endif
 void APIConnection::on_home_assistant_state_response(const HomeAssistantStateResponse &msg) {
   for (auto &it : this->parent_->get_state_subs()) {
     if (it.entity_id == msg.entity_id && it.attribute.value() == msg.attribute) {
@@ -1516,9 +1602,142 @@ void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   state_subs_at_ = 0;
 }
+bool APIConnection::schedule_state_(EntityBase *entity, StateSender sender) {
+  // an encoding shared by another connection is outdated now
+  this->parent_->invalidate_encoded_state(entity);
+  if (!this->state_subscription_)
+    return false;
+
+  auto it = this->dirty_index_.find(entity);
+  if (it != this->dirty_index_.end()) {
+    DirtyState &latest = this->dirty_states_[it->second - this->dirty_seq_];
+    if (latest.sender == sender || this->dirty_states_.size() >= MAX_DIRTY_STATES) {
+      latest.sender = sender;
+      return true;
+    }
+  }
+  this->dirty_index_[entity] = this->dirty_seq_ + this->dirty_states_.size();
+  this->dirty_states_.push_back({entity, sender});
+  return true;
+}
+void APIConnection::process_dirty_states_() {
+  if (this->dirty_states_.empty() || this->remove_)
+    return;
+  if (!this->helper_->can_write_without_blocking()) {
+    // Leave the entities marked, their latest state is sent once the socket has drained
+    return;
+  }
+
+  this->batching_ = true;
+  this->proto_write_buffer_.clear();
+  this->batch_packets_.clear();
+  size_t processed = 0;
+  for (auto &dirty : this->dirty_states_) {
+    // Only the latest queued state of an entity is the one all connections send, older ones are edges
+    auto it = this->dirty_index_.find(dirty.entity);
+    const bool latest = it != this->dirty_index_.end() && it->second == this->dirty_seq_ + processed;
+    if (!latest || !this->append_encoded_state_(dirty.entity)) {
+      const size_t size_before = this->proto_write_buffer_.size();
+      const size_t packets_before = this->batch_packets_.size();
+      if (!(this->*dirty.sender)(dirty.entity)) {
+        // Keep this state and all following ones queued
+        this->proto_write_buffer_.resize(size_before);
+        this->batch_packets_.resize(packets_before);
+        break;
+      }
+      if (latest && this->batch_packets_.size() > packets_before) {
+        // let the other connections reuse this encoding during this loop
+        const PacketInfo &packet = this->batch_packets_.back();
+        this->parent_->set_encoded_state(dirty.entity, packet.message_type, &this->proto_write_buffer_[packet.offset],
+                                         packet.payload_size);
+      }
+    }
+    processed++;
+    if (this->proto_write_buffer_.size() >= MAX_STATE_BATCH_SIZE || this->batch_packets_.size() >= MAX_BATCH_PACKETS)
+      break;
+  }
+  this->batching_ = false;
+  if (processed == 0)
+    return;
+
+  APIError err = this->helper_->write_packets(this->proto_write_buffer_.data(), this->batch_packets_);
+  if (err == APIError::WOULD_BLOCK) {
+    // Nothing was written, try again on the next loop
+    return;
+  }
+  if (err != APIError::OK) {
+    on_fatal_error();
+    ESP_LOGW(TAG, "%s: Packet write failed %s errno=%d", this->client_combined_info_.c_str(), api_error_to_str(err),
+             errno);
+    return;
+  }
+  for (size_t i = 0; i < processed; i++) {
+    auto it = this->dirty_index_.find(this->dirty_states_[i].entity);
+    if (it != this->dirty_index_.end() && it->second == this->dirty_seq_ + i)
+      this->dirty_index_.erase(it);
+  }
+  this->dirty_states_.erase(this->dirty_states_.begin(), this->dirty_states_.begin() + processed);
+  this->dirty_seq_ += processed;
+}
+void APIConnection::list_entities(const ListEntitiesRequest &msg) {
+  if (msg.known_entities_hash != 0) {
+    if (msg.known_entities_hash == this->parent_->get_entities_hash()) {
+      // the client's cache is up to date
+      this->send_list_info_done();
+      return;
+    }
+    auto first_new = this->parent_->get_services_added_since(msg.known_entities_hash);
+    if (first_new.has_value()) {
+      const auto &services = this->parent_->get_user_services();
+      for (size_t i = *first_new; i < services.size(); i++)
+        this->send_list_entities_services_response(services[i]->encode_list_service_response());
+      this->send_list_info_done();
+      return;
+    }
+  }
+  this->list_entities_iterator_.begin();
+}
+uint32_t APIConnection::hash_entities_() {
+  // Encode every entity description exactly like ListEntitiesRequest does, send_buffer() folds them into the hash
+  this->hashing_ = true;
+  this->entities_hash_ = 2166136261UL;
+  ListEntitiesIterator iterator(this);
+  iterator.begin();
+  while (!iterator.completed())
+    iterator.advance();
+  this->hashing_ = false;
+  return this->entities_hash_;
+}
+bool APIConnection::append_encoded_state_(EntityBase *entity) {
+  const APIServer::EncodedState *encoded = this->parent_->get_encoded_state(entity);
+  if (encoded == nullptr)
+    return false;
+  const uint32_t offset = this->proto_write_buffer_.size();
+  const uint8_t *data = this->parent_->get_encoded_state_data(*encoded);
+  this->proto_write_buffer_.insert(this->proto_write_buffer_.end(), data, data + encoded->size);
+  this->batch_packets_.push_back({encoded->message_type, offset, encoded->size});
+  return true;
+}
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
+  if (this->hashing_) {
+    // FNV-1 over the message type and the encoded message, without the reserved frame header
+    const std::vector<uint8_t> &data = *buffer.get_buffer();
+    uint32_t hash = (this->entities_hash_ * 16777619UL) ^ message_type;
+    for (size_t i = this->helper_->frame_header_padding(); i < data.size(); i++)
+      hash = (hash * 16777619UL) ^ data[i];
+    this->entities_hash_ = hash;
+    return true;
+  }
   if (this->remove_)
     return false;
+  if (this->batching_) {
+    uint32_t offset = 0;
+    if (!this->batch_packets_.empty())
+      offset = this->batch_packets_.back().offset + this->batch_packets_.back().payload_size;
+    const uint32_t size = buffer.get_buffer()->size() - offset;
+    this->batch_packets_.push_back({static_cast<uint16_t>(message_type), offset, size});
+    return true;
+  }
   if (!this->helper_->can_write_without_blocking()) {
     delay(0);
     APIError err = this->helper_->loop();
@@ -1538,7 +1757,7 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
   }
 
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  APIError err = this->helper_->write_protobuf_packet(message_type, buffer);
   if (err == APIError::WOULD_BLOCK)
     return false;
   if (err != APIError::OK) {
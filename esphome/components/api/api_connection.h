@@ -9,6 +9,7 @@
 #include "esphome/core/application.h"
 #include "esphome/core/component.h"
 
+#include <unordered_map>
 #include <vector>
 
 namespace esphome {
@@ -175,6 +176,10 @@ class APIConnection : public APIServerConnection {
   void update_command(const UpdateCommandRequest &msg) override;
 #endif
 
+#ifdef USE_PROFILER
+  ComponentProfileResponse component_profile(const ComponentProfileRequest &msg) override;
+#endif
+
   void on_disconnect_response(const DisconnectResponse &value) override;
   void on_ping_response(const PingResponse &value) override {
     // we initiated ping
@@ -190,7 +195,7 @@ class APIConnection : public APIServerConnection {
   DisconnectResponse disconnect(const DisconnectRequest &msg) override;
   PingResponse ping(const PingRequest &msg) override { return {}; }
   DeviceInfoResponse device_info(const DeviceInfoRequest &msg) override;
-  void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
+  void list_entities(const ListEntitiesRequest &msg) override;
   void subscribe_states(const SubscribeStatesRequest &msg) override {
     this->state_subscription_ = true;
     this->initial_state_iterator_.begin();
@@ -217,9 +222,18 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override {
     // FIXME: ensure no recursive writes can happen
+    if (this->batching_) {
+      // While batching, messages are appended after the ones already encoded
+      this->proto_write_buffer_.reserve(this->proto_write_buffer_.size() + reserve_size);
+      return {&this->proto_write_buffer_};
+    }
+    // Leave room for the frame helper to put the header in front of the message
+    const uint8_t header_padding = this->helper_->frame_header_padding();
     this->proto_write_buffer_.clear();
+    this->proto_write_buffer_.reserve(header_padding + reserve_size + this->helper_->frame_footer_size());
+    this->proto_write_buffer_.resize(header_padding);
     return {&this->proto_write_buffer_};
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
@@ -231,6 +245,90 @@ class APIConnection : public APIServerConnection {
 
   bool send_(const void *buf, size_t len, bool force);
 
+  /// Builds the state response for an entity and passes it on to send_buffer().
+  using StateSender = bool (APIConnection::*)(EntityBase *entity);
+  /** Mark the state of \p entity as dirty, it is sent on the next call to process_dirty_states_().
+   *
+   * An entity that is already pending with the same \p sender is not queued again, only its latest state is sent.
+   * This coalesces fast changing entities and keeps updates from getting lost when the socket can't take them right
+   * away. Senders that carry the state themselves (binary sensor edges) are queued once per change instead.
+   */
+  bool schedule_state_(EntityBase *entity, StateSender sender);
+  /// Encode pending states back to back and hand them to the frame helper as one write.
+  void process_dirty_states_();
+  /// Append the state of \p entity to the batch if another connection already encoded it during this loop.
+  bool append_encoded_state_(EntityBase *entity);
+  /** Build the default unique ID of an entity into unique_id_buf_; valid until the next ListEntities message.
+   *
+   * \p object_id is the one already put into the message, it may point into object_id_buf_.
+   */
+  StringRef default_unique_id_ref_(const char *component_type, const StringRef &object_id);
+  /** Hash all entity descriptions, only used by APIServer on a connection without a socket.
+   *
+   * Client connections never hash, so their buffers and log messages are not involved.
+   */
+  uint32_t hash_entities_();
+#ifdef USE_BINARY_SENSOR
+  bool try_send_binary_sensor_state_(EntityBase *entity);
+  bool try_send_binary_sensor_on_(EntityBase *entity);
+  bool try_send_binary_sensor_off_(EntityBase *entity);
+  bool send_binary_sensor_value_(binary_sensor::BinarySensor *binary_sensor, bool state, bool missing_state);
+#endif
+#ifdef USE_COVER
+  bool try_send_cover_state_(EntityBase *entity);
+#endif
+#ifdef USE_FAN
+  bool try_send_fan_state_(EntityBase *entity);
+#endif
+#ifdef USE_LIGHT
+  bool try_send_light_state_(EntityBase *entity);
+#endif
+#ifdef USE_SENSOR
+  bool try_send_sensor_state_(EntityBase *entity);
+#endif
+#ifdef USE_SWITCH
+  bool try_send_switch_state_(EntityBase *entity);
+#endif
+#ifdef USE_TEXT_SENSOR
+  bool try_send_text_sensor_state_(EntityBase *entity);
+#endif
+#ifdef USE_CLIMATE
+  bool try_send_climate_state_(EntityBase *entity);
+#endif
+#ifdef USE_NUMBER
+  bool try_send_number_state_(EntityBase *entity);
+#endif
+#ifdef USE_DATETIME_DATE
+  bool try_send_date_state_(EntityBase *entity);
+#endif
+#ifdef USE_DATETIME_TIME
+  bool try_send_time_state_(EntityBase *entity);
+#endif
+#ifdef USE_DATETIME_DATETIME
+  bool try_send_datetime_state_(EntityBase *entity);
+#endif
+#ifdef USE_TEXT
+  bool try_send_text_state_(EntityBase *entity);
+#endif
+#ifdef USE_SELECT
+  bool try_send_select_state_(EntityBase *entity);
+#endif
+#ifdef USE_LOCK
+  bool try_send_lock_state_(EntityBase *entity);
+#endif
+#ifdef USE_VALVE
+  bool try_send_valve_state_(EntityBase *entity);
+#endif
+#ifdef USE_MEDIA_PLAYER
+  bool try_send_media_player_state_(EntityBase *entity);
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  bool try_send_alarm_control_panel_state_(EntityBase *entity);
+#endif
+#ifdef USE_UPDATE
+  bool try_send_update_state_(EntityBase *entity);
+#endif
+
   enum class ConnectionState {
     WAITING_FOR_HELLO,
     CONNECTED,
@@ -243,6 +341,24 @@ class APIConnection : public APIServerConnection {
   // Re-use to prevent allocations
   std::vector<uint8_t> proto_write_buffer_;
   std::unique_ptr<APIFrameHelper> helper_;
+  // Scratch storage for computed strings referenced by ListEntities messages
+  std::string object_id_buf_;
+  std::string unique_id_buf_;
+
+  struct DirtyState {
+    EntityBase *entity;
+    StateSender sender;
+  };
+  std::vector<DirtyState> dirty_states_;
+  /// Sequence number of the latest queued state of each dirty entity, dirty_states_[0] has dirty_seq_
+  std::unordered_map<EntityBase *, uint32_t> dirty_index_;
+  uint32_t dirty_seq_{0};
+  /// Messages encoded into proto_write_buffer_ while batching
+  std::vector<PacketInfo> batch_packets_;
+  bool batching_{false};
+  /// While set, send_buffer() folds messages into entities_hash_ instead of sending them, see hash_entities_()
+  bool hashing_{false};
+  uint32_t entities_hash_{0};
 
   std::string client_info_;
   std::string client_peername_;
@@ -5,6 +5,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
 #include "proto.h"
+#include <algorithm>
 #include <cstring>
 
 namespace esphome {
@@ -256,9 +257,9 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
 #ifdef HELPER_LOG_PACKETS
   ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
 #endif
-  frame->msg = std::move(rx_buf_);
-  // consume msg
-  rx_buf_ = {};
+  frame->msg = rx_buf_.data();
+  frame->msg_len = rx_buf_len_;
+  // consume msg, rx_buf_ keeps its capacity for the next frame
   rx_buf_len_ = 0;
   rx_header_buf_len_ = 0;
   return APIError::OK;
@@ -295,9 +296,9 @@ APIError APINoiseFrameHelper::state_action_() {
     if (aerr != APIError::OK)
       return aerr;
     // ignore contents, may be used in future for flags
-    prologue_.push_back((uint8_t) (frame.msg.size() >> 8));
-    prologue_.push_back((uint8_t) frame.msg.size());
-    prologue_.insert(prologue_.end(), frame.msg.begin(), frame.msg.end());
+    prologue_.push_back((uint8_t) (frame.msg_len >> 8));
+    prologue_.push_back((uint8_t) frame.msg_len);
+    prologue_.insert(prologue_.end(), frame.msg, frame.msg + frame.msg_len);
 
     state_ = State::SERVER_HELLO;
   }
@@ -340,7 +341,7 @@ APIError APINoiseFrameHelper::state_action_() {
       if (aerr != APIError::OK)
         return aerr;
 
-      if (frame.msg.empty()) {
+      if (frame.msg_len == 0) {
         send_explicit_handshake_reject_("Empty handshake message");
         return APIError::BAD_HANDSHAKE_ERROR_BYTE;
       } else if (frame.msg[0] != 0x00) {
@@ -351,7 +352,7 @@ APIError APINoiseFrameHelper::state_action_() {
 
       NoiseBuffer mbuf;
       noise_buffer_init(mbuf);
-      noise_buffer_set_input(mbuf, frame.msg.data() + 1, frame.msg.size() - 1);
+      noise_buffer_set_input(mbuf, frame.msg + 1, frame.msg_len - 1);
       err = noise_handshakestate_read_message(handshake_, &mbuf, nullptr);
       if (err != 0) {
         state_ = State::FAILED;
@@ -432,7 +433,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
 
   NoiseBuffer mbuf;
   noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, frame.msg.data(), frame.msg.size(), frame.msg.size());
+  noise_buffer_set_inout(mbuf, frame.msg, frame.msg_len, frame.msg_len);
   err = noise_cipherstate_decrypt(recv_cipher_, &mbuf);
   if (err != 0) {
     state_ = State::FAILED;
@@ -441,7 +442,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   }
 
   size_t msg_size = mbuf.size;
-  uint8_t *msg_data = frame.msg.data();
+  uint8_t *msg_data = frame.msg;
   if (msg_size < 4) {
     state_ = State::FAILED;
     HELPER_LOG("Bad data packet: size %d too short", msg_size);
@@ -460,15 +461,13 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
     return APIError::BAD_DATA_PACKET;
   }
 
-  buffer->container = std::move(frame.msg);
-  buffer->data_offset = 4;
+  buffer->data = msg_data + 4;
   buffer->data_len = data_len;
   buffer->type = type;
   return APIError::OK;
 }
 bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
 APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
-  int err;
   APIError aerr;
   aerr = state_action_();
   if (aerr != APIError::OK) {
@@ -479,53 +478,143 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
     return APIError::WOULD_BLOCK;
   }
 
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
+  size_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  size_t frame_len = 3 + 4 + payload_len + mac_len;
+  frame_buf_.resize(frame_len);
+
+  aerr = this->encrypt_packet_(type, payload, payload_len, frame_buf_.data(), mac_len, &frame_len);
+  if (aerr != APIError::OK)
+    return aerr;
+
+  struct iovec iov;
+  iov.iov_base = frame_buf_.data();
+  iov.iov_len = frame_len;
+
+  // write raw to not have two packets sent if NAGLE disabled
+  return write_raw_(&iov, 1);
+}
+APIError APINoiseFrameHelper::write_packets(const uint8_t *data, const std::vector<PacketInfo> &packets) {
+  APIError aerr;
+  aerr = state_action_();
+  if (aerr != APIError::OK) {
+    return aerr;
+  }
+
+  if (state_ != State::DATA) {
+    return APIError::WOULD_BLOCK;
   }
 
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
+  if (packets.empty())
+    return APIError::OK;
+
+  // every packet becomes its own encrypted frame, all frames are sent with a single write
+  size_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  size_t buf_len = 0;
+  for (const auto &packet : packets)
+    buf_len += 3 + 4 + packet.payload_size + mac_len;
+  frame_buf_.resize(buf_len);
+
+  size_t total_len = 0;
+  for (const auto &packet : packets) {
+    size_t frame_len;
+    aerr = this->encrypt_packet_(packet.message_type, data + packet.offset, packet.payload_size, &frame_buf_[total_len],
+                                 mac_len, &frame_len);
+    if (aerr != APIError::OK)
+      return aerr;
+    total_len += frame_len;
+  }
+
+  struct iovec iov;
+  iov.iov_base = frame_buf_.data();
+  iov.iov_len = total_len;
+
+  // write raw to not have two packets sent if NAGLE disabled
+  return write_raw_(&iov, 1);
+}
+// indicator, 2 bytes frame size, 2 bytes message type and 2 bytes data length
+static const uint8_t NOISE_HEADER_PADDING = 7;
+/** Frame and encrypt a single packet
+ *
+ * @param out Buffer for the frame, must have room for 7 + payload_len + mac_len bytes
+ * @param frame_len Set to the length of the frame written to out
+ */
+APIError APINoiseFrameHelper::encrypt_packet_(uint16_t type, const uint8_t *payload, size_t payload_len, uint8_t *out,
+                                              size_t mac_len, size_t *frame_len) {
+  // copy data behind the frame and message headers
+  std::copy(payload, payload + payload_len, &out[NOISE_HEADER_PADDING]);
+  return this->encrypt_frame_in_place_(type, out, payload_len, mac_len, frame_len);
+}
+/** Frame and encrypt a packet whose payload is already in place
+ *
+ * @param frame Buffer with the payload at offset 7 and room for mac_len bytes behind it
+ * @param frame_len Set to the length of the frame
+ */
+APIError APINoiseFrameHelper::encrypt_frame_in_place_(uint16_t type, uint8_t *frame, size_t payload_len, size_t mac_len,
+                                                      size_t *frame_len) {
+  size_t msg_len = 4 + payload_len;
+
+  frame[0] = 0x01;  // indicator
+  // frame[1], frame[2] to be set later
   const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+  frame[msg_offset + 0] = (uint8_t) (type >> 8);  // type
+  frame[msg_offset + 1] = (uint8_t) type;
+  frame[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
+  frame[msg_offset + 3] = (uint8_t) payload_len;
 
   NoiseBuffer mbuf;
   noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
-  err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
+  noise_buffer_set_inout(mbuf, &frame[msg_offset], msg_len, msg_len + mac_len);
+  int err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
   if (err != 0) {
     state_ = State::FAILED;
     HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
     return APIError::CIPHERSTATE_ENCRYPT_FAILED;
   }
 
-  size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t) (mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
+  frame[1] = (uint8_t) (mbuf.size >> 8);
+  frame[2] = (uint8_t) mbuf.size;
+  *frame_len = 3 + mbuf.size;
+  return APIError::OK;
+}
+APIError APINoiseFrameHelper::write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) {
+  APIError aerr;
+  aerr = state_action_();
+  if (aerr != APIError::OK) {
+    return aerr;
+  }
+
+  if (state_ != State::DATA) {
+    return APIError::WOULD_BLOCK;
+  }
+
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  const size_t payload_len = raw_buffer->size() - NOISE_HEADER_PADDING;
+  const size_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  // space for the MAC was reserved with the buffer, so this does not reallocate
+  raw_buffer->resize(raw_buffer->size() + mac_len);
+
+  size_t frame_len;
+  aerr = this->encrypt_frame_in_place_(type, raw_buffer->data(), payload_len, mac_len, &frame_len);
+  if (aerr != APIError::OK)
+    return aerr;
 
   struct iovec iov;
-  iov.iov_base = &tmpbuf[0];
-  iov.iov_len = total_len;
+  iov.iov_base = raw_buffer->data();
+  iov.iov_len = frame_len;
 
   // write raw to not have two packets sent if NAGLE disabled
   return write_raw_(&iov, 1);
 }
+uint8_t APINoiseFrameHelper::frame_header_padding() { return NOISE_HEADER_PADDING; }
+uint8_t APINoiseFrameHelper::frame_footer_size() {
+  if (send_cipher_ == nullptr)
+    return 0;
+  return noise_cipherstate_get_mac_length(send_cipher_);
+}
 APIError APINoiseFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
   while (state_ != State::CLOSED && !tx_buf_.empty()) {
-    ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
+    ssize_t sent = socket_->write(&tx_buf_[tx_buf_head_], tx_buf_.size() - tx_buf_head_);
     if (sent == -1) {
       if (errno == EWOULDBLOCK || errno == EAGAIN)
         break;
@@ -535,9 +624,12 @@ APIError APINoiseFrameHelper::try_send_tx_buf_() {
     } else if (sent == 0) {
       break;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
-    tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
+    // only move the head, the buffer is reset once everything is sent
+    tx_buf_head_ += sent;
+    if (tx_buf_head_ == tx_buf_.size()) {
+      tx_buf_.clear();
+      tx_buf_head_ = 0;
+    }
   }
 
   return APIError::OK;
@@ -570,6 +662,11 @@ APIError APINoiseFrameHelper::write_raw_(const struct iovec *iov, int iovcnt) {
 
   if (!tx_buf_.empty()) {
     // tx buf not empty, can't write now because then stream would be inconsistent
+    if (tx_buf_head_ > tx_buf_.size() / 2) {
+      // drop what was already sent before growing the queue
+      tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + tx_buf_head_);
+      tx_buf_head_ = 0;
+    }
     for (int i = 0; i < iovcnt; i++) {
       tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
                      reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
@@ -875,9 +972,9 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
 #ifdef HELPER_LOG_PACKETS
   ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
 #endif
-  frame->msg = std::move(rx_buf_);
-  // consume msg
-  rx_buf_ = {};
+  frame->msg = rx_buf_.data();
+  frame->msg_len = rx_buf_len_;
+  // consume msg, rx_buf_ keeps its capacity for the next frame
   rx_buf_len_ = 0;
   rx_header_buf_.clear();
   rx_header_parsed_ = false;
@@ -896,8 +993,7 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   if (aerr != APIError::OK)
     return aerr;
 
-  buffer->container = std::move(frame.msg);
-  buffer->data_offset = 0;
+  buffer->data = frame.msg;
   buffer->data_len = rx_header_parsed_len_;
   buffer->type = rx_header_parsed_type_;
   return APIError::OK;
@@ -924,10 +1020,77 @@ APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *pay
 
   return write_raw_(iov, 2);
 }
+APIError APIPlaintextFrameHelper::write_packets(const uint8_t *data, const std::vector<PacketInfo> &packets) {
+  if (state_ != State::DATA) {
+    return APIError::BAD_STATE;
+  }
+
+  // indicator, up to 5 bytes of payload size and 3 bytes of message type per packet
+  uint8_t headers[MAX_BATCH_PACKETS * 9];
+  struct iovec iov[MAX_BATCH_PACKETS * 2];
+  // larger batches are written in several parts, which keeps them in order all the same
+  for (size_t start = 0; start < packets.size(); start += MAX_BATCH_PACKETS) {
+    const size_t end = std::min(packets.size(), start + MAX_BATCH_PACKETS);
+    uint8_t *header = headers;
+    int iovcnt = 0;
+    for (size_t i = start; i < end; i++) {
+      const PacketInfo &packet = packets[i];
+      const uint32_t size_len = ProtoSize::varint(packet.payload_size);
+      const uint32_t type_len = ProtoSize::varint(static_cast<uint32_t>(packet.message_type));
+      header[0] = 0x00;
+      ProtoVarInt(packet.payload_size).encode_to_buffer_unchecked(header + 1, size_len);
+      ProtoVarInt(packet.message_type).encode_to_buffer_unchecked(header + 1 + size_len, type_len);
+      iov[iovcnt].iov_base = header;
+      iov[iovcnt].iov_len = 1 + size_len + type_len;
+      iovcnt++;
+      header += 1 + size_len + type_len;
+      if (packet.payload_size == 0)
+        continue;
+      iov[iovcnt].iov_base = const_cast<uint8_t *>(data + packet.offset);
+      iov[iovcnt].iov_len = packet.payload_size;
+      iovcnt++;
+    }
+    APIError aerr = write_raw_(iov, iovcnt);
+    if (aerr != APIError::OK)
+      return aerr;
+  }
+  return APIError::OK;
+}
+// indicator, up to 3 bytes of payload size and 2 bytes of message type
+static const uint8_t PLAINTEXT_HEADER_PADDING = 6;
+APIError APIPlaintextFrameHelper::write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) {
+  if (state_ != State::DATA) {
+    return APIError::BAD_STATE;
+  }
+
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  const size_t payload_len = raw_buffer->size() - PLAINTEXT_HEADER_PADDING;
+  const uint8_t *payload = raw_buffer->data() + PLAINTEXT_HEADER_PADDING;
+  const uint32_t size_len = ProtoSize::varint(static_cast<uint32_t>(payload_len));
+  const uint32_t type_len = ProtoSize::varint(static_cast<uint32_t>(type));
+  const uint32_t header_len = 1 + size_len + type_len;
+  if (header_len > PLAINTEXT_HEADER_PADDING) {
+    // does not fit in the reserved space, fall back to a separate header
+    return this->write_packet(type, payload, payload_len);
+  }
+
+  // put the header right in front of the payload so both go out as one contiguous block
+  uint8_t *header = raw_buffer->data() + PLAINTEXT_HEADER_PADDING - header_len;
+  header[0] = 0x00;
+  ProtoVarInt(payload_len).encode_to_buffer_unchecked(header + 1, size_len);
+  ProtoVarInt(type).encode_to_buffer_unchecked(header + 1 + size_len, type_len);
+
+  struct iovec iov;
+  iov.iov_base = header;
+  iov.iov_len = header_len + payload_len;
+  return write_raw_(&iov, 1);
+}
+uint8_t APIPlaintextFrameHelper::frame_header_padding() { return PLAINTEXT_HEADER_PADDING; }
+uint8_t APIPlaintextFrameHelper::frame_footer_size() { return 0; }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
   while (state_ != State::CLOSED && !tx_buf_.empty()) {
-    ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
+    ssize_t sent = socket_->write(&tx_buf_[tx_buf_head_], tx_buf_.size() - tx_buf_head_);
     if (is_would_block(sent)) {
       break;
     } else if (sent == -1) {
@@ -935,9 +1098,12 @@ APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
       HELPER_LOG("Socket write failed with errno %d", errno);
       return APIError::SOCKET_WRITE_FAILED;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
-    tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
+    // only move the head, the buffer is reset once everything is sent
+    tx_buf_head_ += sent;
+    if (tx_buf_head_ == tx_buf_.size()) {
+      tx_buf_.clear();
+      tx_buf_head_ = 0;
+    }
   }
 
   return APIError::OK;
@@ -970,6 +1136,11 @@ APIError APIPlaintextFrameHelper::write_raw_(const struct iovec *iov, int iovcnt
 
   if (!tx_buf_.empty()) {
     // tx buf not empty, can't write now because then stream would be inconsistent
+    if (tx_buf_head_ > tx_buf_.size() / 2) {
+      // drop what was already sent before growing the queue
+      tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + tx_buf_head_);
+      tx_buf_head_ = 0;
+    }
     for (int i = 0; i < iovcnt; i++) {
       tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
                      reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
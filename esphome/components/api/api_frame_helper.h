@@ -12,14 +12,15 @@
 
 #include "api_noise_context.h"
 #include "esphome/components/socket/socket.h"
+#include "proto.h"
 
 namespace esphome {
 namespace api {
 
 struct ReadPacketBuffer {
-  std::vector<uint8_t> container;
+  /// Points into the frame helper's receive buffer, valid until the next call to read_packet()
+  uint8_t *data;
   uint16_t type;
-  size_t data_offset;
   size_t data_len;
 };
 
@@ -30,6 +31,16 @@ struct PacketBuffer {
   uint8_t data_len;
 };
 
+/// Packets of a batch that APIFrameHelper::write_packets() sends with a single write
+static const size_t MAX_BATCH_PACKETS = 16;
+
+/// Location of one encoded message inside a buffer holding several of them, see APIFrameHelper::write_packets()
+struct PacketInfo {
+  uint16_t message_type;
+  uint32_t offset;
+  uint32_t payload_size;
+};
+
 enum class APIError : int {
   OK = 0,
   WOULD_BLOCK = 1001,
@@ -66,6 +77,14 @@ class APIFrameHelper {
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
   virtual bool can_write_without_blocking() = 0;
   virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  /// Write several messages encoded back to back in \p data, framed individually but sent in a single write.
+  virtual APIError write_packets(const uint8_t *data, const std::vector<PacketInfo> &packets) = 0;
+  /// Write a message encoded after frame_header_padding() reserved bytes, so the header can be filled in place.
+  virtual APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) = 0;
+  /// Bytes to reserve in front of an encoded message for the frame header
+  virtual uint8_t frame_header_padding() = 0;
+  /// Bytes to reserve after an encoded message, for example for a MAC
+  virtual uint8_t frame_footer_size() = 0;
   virtual std::string getpeername() = 0;
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual APIError close() = 0;
@@ -85,6 +104,10 @@ class APINoiseFrameHelper : public APIFrameHelper {
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
   APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_packets(const uint8_t *data, const std::vector<PacketInfo> &packets) override;
+  APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) override;
+  uint8_t frame_header_padding() override;
+  uint8_t frame_footer_size() override;
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -96,13 +119,19 @@ class APINoiseFrameHelper : public APIFrameHelper {
 
  protected:
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    /// Points into rx_buf_, which is kept and reused for the next frame
+    uint8_t *msg;
+    size_t msg_len;
   };
 
   APIError state_action_();
   APIError try_read_frame_(ParsedFrame *frame);
   APIError try_send_tx_buf_();
   APIError write_frame_(const uint8_t *data, size_t len);
+  APIError encrypt_packet_(uint16_t type, const uint8_t *payload, size_t payload_len, uint8_t *out, size_t mac_len,
+                           size_t *frame_len);
+  APIError encrypt_frame_in_place_(uint16_t type, uint8_t *frame, size_t payload_len, size_t mac_len,
+                                   size_t *frame_len);
   APIError write_raw_(const struct iovec *iov, int iovcnt);
   APIError init_handshake_();
   APIError check_handshake_finished_();
@@ -117,6 +146,10 @@ class APINoiseFrameHelper : public APIFrameHelper {
   size_t rx_buf_len_ = 0;
 
   std::vector<uint8_t> tx_buf_;
+  /// Start of the data in tx_buf_ that has not been sent yet
+  size_t tx_buf_head_ = 0;
+  /// Scratch buffer for frames that could not be encrypted in place, kept to avoid an allocation per packet
+  std::vector<uint8_t> frame_buf_;
   std::vector<uint8_t> prologue_;
 
   std::shared_ptr<APINoiseContext> ctx_;
@@ -148,6 +181,10 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
   APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_packets(const uint8_t *data, const std::vector<PacketInfo> &packets) override;
+  APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) override;
+  uint8_t frame_header_padding() override;
+  uint8_t frame_footer_size() override;
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -159,7 +196,9 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
 
  protected:
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    /// Points into rx_buf_, which is kept and reused for the next frame
+    uint8_t *msg;
+    size_t msg_len;
   };
 
   APIError try_read_frame_(ParsedFrame *frame);
@@ -178,6 +217,8 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   size_t rx_buf_len_ = 0;
 
   std::vector<uint8_t> tx_buf_;
+  /// Start of the data in tx_buf_ that has not been sent yet
+  size_t tx_buf_head_ = 0;
 
   enum class State {
     INITIALIZE = 1,
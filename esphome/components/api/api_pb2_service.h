@@ -330,6 +330,12 @@ class APIServerConnectionBase : public ProtoService {
 #endif
 #ifdef USE_UPDATE
   virtual void on_update_command_request(const UpdateCommandRequest &value){};
+#endif
+#ifdef USE_PROFILER
+  virtual void on_component_profile_request(const ComponentProfileRequest &value){};
+#endif
+#ifdef USE_PROFILER
+  bool send_component_profile_response(const ComponentProfileResponse &msg);
 #endif
  protected:
   bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) override;
@@ -443,6 +449,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
   virtual void alarm_control_panel_command(const AlarmControlPanelCommandRequest &msg) = 0;
+#endif
+#ifdef USE_PROFILER
+  virtual ComponentProfileResponse component_profile(const ComponentProfileRequest &msg) = 0;
 #endif
  protected:
   void on_hello_request(const HelloRequest &msg) override;
@@ -551,6 +560,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_ALARM_CONTROL_PANEL
   void on_alarm_control_panel_command_request(const AlarmControlPanelCommandRequest &msg) override;
 #endif
+#ifdef USE_PROFILER
+  void on_component_profile_request(const ComponentProfileRequest &msg) override;
+#endif
 };
 
 }  // namespace api
@@ -79,6 +79,8 @@ void APIServer::setup() {
 #endif
 
   this->last_connected_ = millis();
+  // all entities are registered by now
+  this->get_entities_hash();
 
 #ifdef USE_ESP32_CAMERA
   if (esp32_camera::global_esp32_camera != nullptr && !esp32_camera::global_esp32_camera->is_internal()) {
@@ -121,6 +123,9 @@ void APIServer::loop() {
   for (auto &client : this->clients_) {
     client->loop();
   }
+  // shared encodings are only valid within one pass over the clients, the buffer keeps its capacity
+  this->encoded_states_.clear();
+  this->encoded_state_buf_.clear();
 
   if (this->reboot_timeout_ != 0) {
     const uint32_t now = millis();
@@ -347,6 +352,46 @@ void APIServer::set_port(uint16_t port) { this->port_ = port; }
 APIServer *global_api_server = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 void APIServer::set_password(const std::string &password) { this->password_ = password; }
+void APIServer::register_user_service(UserServiceDescriptor *descriptor) {
+  if (this->entities_hash_valid_) {
+    // Clients that cached the current entities only need the services added from here on
+    this->previous_entities_hash_ = this->entities_hash_;
+    this->previous_service_count_ = this->user_services_.size();
+    this->entities_hash_valid_ = false;
+  }
+  this->user_services_.push_back(descriptor);
+}
+uint32_t APIServer::get_entities_hash() {
+  if (!this->entities_hash_valid_) {
+    // A connection without a socket encodes the descriptions, it never sends anything
+    APIConnection hasher(nullptr, this);
+    this->entities_hash_ = hasher.hash_entities_();
+    this->entities_hash_valid_ = true;
+  }
+  return this->entities_hash_;
+}
+const APIServer::EncodedState *APIServer::get_encoded_state(EntityBase *entity) const {
+  auto it = this->encoded_states_.find(entity);
+  if (it == this->encoded_states_.end())
+    return nullptr;
+  return &it->second;
+}
+void APIServer::set_encoded_state(EntityBase *entity, uint16_t message_type, const uint8_t *data, uint32_t size) {
+  if (this->clients_.size() < 2)
+    return;
+  const uint32_t offset = this->encoded_state_buf_.size();
+  this->encoded_state_buf_.insert(this->encoded_state_buf_.end(), data, data + size);
+  this->encoded_states_[entity] = {message_type, offset, size};
+}
+void APIServer::invalidate_encoded_state(EntityBase *entity) {
+  if (!this->encoded_states_.empty())
+    this->encoded_states_.erase(entity);
+}
+optional<size_t> APIServer::get_services_added_since(uint32_t hash) const {
+  if (!this->previous_service_count_.has_value() || hash != this->previous_entities_hash_)
+    return {};
+  return this->previous_service_count_;
+}
 void APIServer::send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
   for (auto &client : this->clients_) {
     client->send_homeassistant_service_call(call);
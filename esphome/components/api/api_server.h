@@ -9,11 +9,13 @@
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
+#include "esphome/core/entity_base.h"
 #include "esphome/core/log.h"
 #include "list_entities.h"
 #include "subscribe_state.h"
 #include "user_services.h"
 
+#include <unordered_map>
 #include <vector>
 
 namespace esphome {
@@ -92,7 +94,7 @@ class APIServer : public Component, public Controller {
   void on_media_player_update(media_player::MediaPlayer *obj) override;
 #endif
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call);
-  void register_user_service(UserServiceDescriptor *descriptor) { this->user_services_.push_back(descriptor); }
+  void register_user_service(UserServiceDescriptor *descriptor);
 #ifdef USE_HOMEASSISTANT_TIME
   void request_time();
 #endif
@@ -123,6 +125,24 @@ class APIServer : public Component, public Controller {
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
   const std::vector<UserServiceDescriptor *> &get_user_services() const { return this->user_services_; }
 
+  /// Hash of all entity descriptions, computed in setup() and again after user services were added
+  uint32_t get_entities_hash();
+  /// Index of the first user service registered after \p hash was the entities hash, if that is still known
+  optional<size_t> get_services_added_since(uint32_t hash) const;
+
+  /// A state message encoded by one connection, shared with the others until the end of this loop
+  struct EncodedState {
+    uint16_t message_type;
+    uint32_t offset;
+    uint32_t size;
+  };
+  const EncodedState *get_encoded_state(EntityBase *entity) const;
+  const uint8_t *get_encoded_state_data(const EncodedState &state) const {
+    return &this->encoded_state_buf_[state.offset];
+  }
+  void set_encoded_state(EntityBase *entity, uint16_t message_type, const uint8_t *data, uint32_t size);
+  void invalidate_encoded_state(EntityBase *entity);
+
   Trigger<std::string, std::string> *get_client_connected_trigger() const { return this->client_connected_trigger_; }
   Trigger<std::string, std::string> *get_client_disconnected_trigger() const {
     return this->client_disconnected_trigger_;
@@ -137,6 +157,14 @@ class APIServer : public Component, public Controller {
   std::string password_;
   std::vector<HomeAssistantStateSubscription> state_subs_;
   std::vector<UserServiceDescriptor *> user_services_;
+  uint32_t entities_hash_{0};
+  bool entities_hash_valid_{false};
+  // Entities hash before services were registered at runtime, and how many services there were back then
+  uint32_t previous_entities_hash_{0};
+  optional<size_t> previous_service_count_{};
+  // Encoded states of the current loop, only kept while more than one client is connected
+  std::unordered_map<EntityBase *, EncodedState> encoded_states_;
+  std::vector<uint8_t> encoded_state_buf_;
   Trigger<std::string, std::string> *client_connected_trigger_ = new Trigger<std::string, std::string>();
   Trigger<std::string, std::string> *client_disconnected_trigger_ = new Trigger<std::string, std::string>();
 
@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/string_ref.h"
 
 #include <vector>
 
@@ -71,6 +72,15 @@ class ProtoVarInt {
       return static_cast<int64_t>(this->value_ >> 1);
     }
   }
+  /// Encode into \p buffer, which must have room for exactly \p len = ProtoSize::varint() bytes.
+  void encode_to_buffer_unchecked(uint8_t *buffer, size_t len) const {
+    uint64_t val = this->value_;
+    for (size_t i = 0; i < len; i++) {
+      uint8_t temp = val & 0x7F;
+      val >>= 7;
+      buffer[i] = i + 1 < len ? temp | 0x80 : temp;
+    }
+  }
   void encode(std::vector<uint8_t> &out) {
     uint64_t val = this->value_;
     if (val <= 0x7F) {
@@ -96,11 +106,14 @@ class ProtoLengthDelimited {
  public:
   explicit ProtoLengthDelimited(const uint8_t *value, size_t length) : value_(value), length_(length) {}
   std::string as_string() const { return std::string(reinterpret_cast<const char *>(this->value_), this->length_); }
+  /// View into the receive buffer, only valid until the message handler returns.
+  StringRef as_string_ref() const { return StringRef(this->value_, this->length_); }
   template<class C> C as_message() const {
     auto msg = C();
     msg.decode(this->value_, this->length_);
     return msg;
   }
+  template<class C> void decode_to_message(C &msg) const { msg.decode(this->value_, this->length_); }
 
  protected:
   const uint8_t *const value_;
@@ -143,6 +156,127 @@ class Proto64Bit {
   const uint64_t value_;
 };
 
+/** Computes the encoded size of messages, so buffers can be sized before encoding.
+ *
+ * Every add_*_field() mirrors the matching ProtoWriteBuffer::encode_*() method, including which values are skipped.
+ * \p field_id_size is the size of the field tag, which the code generator computes up front.
+ */
+class ProtoSize {
+ public:
+  static uint32_t varint(uint32_t value) {
+    if (value < 1 << 7)
+      return 1;
+    if (value < 1 << 14)
+      return 2;
+    if (value < 1 << 21)
+      return 3;
+    if (value < 1 << 28)
+      return 4;
+    return 5;
+  }
+  static uint32_t varint(uint64_t value) {
+    if (value <= UINT32_MAX)
+      return varint(static_cast<uint32_t>(value));
+    uint32_t size = 5;
+    value >>= 35;
+    while (value) {
+      value >>= 7;
+      size++;
+    }
+    return size;
+  }
+
+  static void add_uint32_field(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_uint64_field(uint32_t &total_size, uint32_t field_id_size, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_int32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force = false) {
+    if (value < 0) {
+      // negative int32 is always 10 byte long
+      add_int64_field(total_size, field_id_size, value, force);
+      return;
+    }
+    add_uint32_field(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_int64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force = false) {
+    add_uint64_field(total_size, field_id_size, static_cast<uint64_t>(value), force);
+  }
+  static void add_sint32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force = false) {
+    uint32_t uvalue = value < 0 ? ~(value << 1) : value << 1;
+    add_uint32_field(total_size, field_id_size, uvalue, force);
+  }
+  static void add_sint64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force = false) {
+    uint64_t uvalue = value < 0 ? ~(value << 1) : value << 1;
+    add_uint64_field(total_size, field_id_size, uvalue, force);
+  }
+  static void add_bool_field(uint32_t &total_size, uint32_t field_id_size, bool value, bool force = false) {
+    if (!value && !force)
+      return;
+    total_size += field_id_size + 1;
+  }
+  static void add_fixed32_field(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + 4;
+  }
+  static void add_fixed64_field(uint32_t &total_size, uint32_t field_id_size, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + 8;
+  }
+  static void add_float_field(uint32_t &total_size, uint32_t field_id_size, float value, bool force = false) {
+    if (value == 0.0f && !force)
+      return;
+    union {
+      float value;
+      uint32_t raw;
+    } val{};
+    val.value = value;
+    // encode_float() does not forward force
+    add_fixed32_field(total_size, field_id_size, val.raw);
+  }
+  static void add_double_field(uint32_t &total_size, uint32_t field_id_size, double value, bool force = false) {
+    if (value == 0.0 && !force)
+      return;
+    total_size += field_id_size + 8;
+  }
+  static void add_sfixed32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force = false) {
+    add_fixed32_field(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_sfixed64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force = false) {
+    add_fixed64_field(total_size, field_id_size, static_cast<uint64_t>(value), force);
+  }
+  template<typename T>
+  static void add_enum_field(uint32_t &total_size, uint32_t field_id_size, T value, bool force = false) {
+    add_uint32_field(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_string_field(uint32_t &total_size, uint32_t field_id_size, size_t len, bool force = false) {
+    if (len == 0 && !force)
+      return;
+    total_size += field_id_size + varint(static_cast<uint32_t>(len)) + len;
+  }
+  static void add_string_field(uint32_t &total_size, uint32_t field_id_size, const std::string &value,
+                               bool force = false) {
+    // encode_string() does not forward force for std::string
+    add_string_field(total_size, field_id_size, value.size());
+  }
+  static void add_string_field(uint32_t &total_size, uint32_t field_id_size, const StringRef &value,
+                               bool force = false) {
+    add_string_field(total_size, field_id_size, value.size());
+  }
+  template<class C> static void add_message_object(uint32_t &total_size, uint32_t field_id_size, const C &value) {
+    uint32_t nested_size = 0;
+    value.calculate_size(nested_size);
+    total_size += field_id_size + varint(nested_size) + nested_size;
+  }
+};
+
 class ProtoWriteBuffer {
  public:
   ProtoWriteBuffer(std::vector<uint8_t> *buffer) : buffer_(buffer) {}
@@ -165,6 +299,9 @@ class ProtoWriteBuffer {
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
     this->encode_string(field_id, value.data(), value.size());
   }
+  void encode_string(uint32_t field_id, const StringRef &value, bool force = false) {
+    this->encode_string(field_id, value.c_str(), value.size());
+  }
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
   }
@@ -255,15 +392,11 @@ class ProtoWriteBuffer {
   }
   template<class C> void encode_message(uint32_t field_id, const C &value, bool force = false) {
     this->encode_field_raw(field_id, 2);
-    size_t begin = this->buffer_->size();
-
+    // size the nested message up front instead of inserting its length in front of it afterwards
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    this->encode_varint_raw(nested_length);
     value.encode(*this);
-
-    const uint32_t nested_length = this->buffer_->size() - begin;
-    // add size varint
-    std::vector<uint8_t> var;
-    ProtoVarInt(nested_length).encode(var);
-    this->buffer_->insert(this->buffer_->begin() + begin, var.begin(), var.end());
   }
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
@@ -275,6 +408,8 @@ class ProtoMessage {
  public:
   virtual ~ProtoMessage() = default;
   virtual void encode(ProtoWriteBuffer buffer) const = 0;
+  /// Add the number of bytes encode() writes to \p total_size.
+  virtual void calculate_size(uint32_t &total_size) const = 0;
   void decode(const uint8_t *buffer, size_t length);
 #ifdef HAS_PROTO_MESSAGE_DUMP
   std::string dump() const;
@@ -298,12 +433,15 @@ class ProtoService {
   virtual void on_fatal_error() = 0;
   virtual void on_unauthenticated_access() = 0;
   virtual void on_no_setup_connection() = 0;
-  virtual ProtoWriteBuffer create_buffer() = 0;
+  /// Get a buffer to encode a message of \p reserve_size bytes into.
+  virtual ProtoWriteBuffer create_buffer(uint32_t reserve_size) = 0;
   virtual bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) = 0;
   virtual bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) = 0;
 
   template<class C> bool send_message_(const C &msg, uint32_t message_type) {
-    auto buffer = this->create_buffer();
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    auto buffer = this->create_buffer(msg_size);
     msg.encode(buffer);
     return this->send_buffer(buffer, message_type);
   }
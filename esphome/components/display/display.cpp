@@ -19,11 +19,13 @@ void HOT Display::line(int x1, int y1, int x2, int y2, Color color) {
   const int32_t dx = abs(x2 - x1), sx = x1 < x2 ? 1 : -1;
   const int32_t dy = -abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
   int32_t err = dx + dy;
+  // pixels of the same row are drawn together as one span
+  int run_x = x1;
 
   while (true) {
-    this->draw_pixel_at(x1, y1, color);
     if (x1 == x2 && y1 == y2)
       break;
+    const int prev_x = x1, prev_y = y1;
     int32_t e2 = 2 * err;
     if (e2 >= dy) {
       err += dy;
@@ -33,6 +35,18 @@ void HOT Display::line(int x1, int y1, int x2, int y2, Color color) {
       err += dx;
       y1 += sy;
     }
+    if (y1 != prev_y) {
+      this->line_run_(run_x, prev_x, prev_y, color);
+      run_x = x1;
+    }
+  }
+  this->line_run_(run_x, x1, y1, color);
+}
+void HOT Display::line_run_(int x1, int x2, int y, Color color) {
+  if (x1 == x2) {
+    this->draw_pixel_at(x1, y, color);
+  } else {
+    this->fill_span(std::min(x1, x2), y, abs(x2 - x1) + 1, color);
   }
 }
 
@@ -85,11 +99,15 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
+void HOT Display::fill_span(int x, int y, int w, Color color) {
+  for (int i = x; i < x + w; i++)
     this->draw_pixel_at(i, y, color);
 }
+void HOT Display::blit_span_565(int x, int y, int w, const uint8_t *data) {
+  for (int i = 0; i < w; i++, data += 2)
+    this->draw_pixel_at(x + i, y, ColorUtil::rgb565_to_color(encode_uint16(data[0], data[1])));
+}
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
 void HOT Display::vertical_line(int x, int y, int height, Color color) {
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = y; i < y + height; i++)
@@ -102,7 +120,6 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
   for (int i = y1; i < y1 + height; i++) {
     this->horizontal_line(x1, i, width, color);
   }
@@ -137,13 +154,11 @@ void Display::filled_circle(int center_x, int center_y, int radius, Color color)
   int e2;
 
   do {
-    this->draw_pixel_at(center_x - dx, center_y + dy, color);
-    this->draw_pixel_at(center_x + dx, center_y + dy, color);
-    this->draw_pixel_at(center_x + dx, center_y - dy, color);
-    this->draw_pixel_at(center_x - dx, center_y - dy, color);
+    // the lines include the outline pixels
     int hline_width = 2 * (-dx) + 1;
     this->horizontal_line(center_x + dx, center_y + dy, hline_width, color);
-    this->horizontal_line(center_x + dx, center_y - dy, hline_width, color);
+    if (dy != 0)
+      this->horizontal_line(center_x + dx, center_y - dy, hline_width, color);
     e2 = err;
     if (e2 < dy) {
       err += ++dy * 2 + 1;
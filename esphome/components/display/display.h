@@ -228,6 +228,20 @@ class Display : public PollingComponent {
   /// Set a single pixel at the specified coordinates to the given color.
   virtual void draw_pixel_at(int x, int y, Color color) = 0;
 
+  /** Set a horizontal run of pixels starting at [x,y] going right to the given color.
+   *
+   * The naive implementation here draws each pixel, displays with a buffer override it to clip and rotate the run
+   * once instead of per pixel. All horizontal lines and filled shapes are drawn through this.
+   */
+  virtual void fill_span(int x, int y, int w, Color color);
+
+  /** Set a horizontal run of w pixels starting at [x,y] going right from big-endian RGB565 data, 2 bytes per pixel.
+   *
+   * Like fill_span() the naive implementation here draws each pixel, displays with a buffer clip and rotate the run
+   * once. Unlike draw_pixels_at() the run is clipped like draw_pixel_at() and goes through the buffer.
+   */
+  virtual void blit_span_565(int x, int y, int w, const uint8_t *data);
+
   /** Given an array of pixels encoded in the nominated format, draw these into the display's buffer.
    * The naive implementation here will work in all cases, but can be overridden by sub-classes
    * in order to optimise the procedure.
@@ -676,6 +690,8 @@ class Display : public PollingComponent {
    */
   void filled_flat_side_triangle_(int x1, int y1, int x2, int y2, int x3, int y3, Color color);
   void sort_triangle_points_by_y_(int *x1, int *y1, int *x2, int *y2, int *x3, int *y3);
+  /// Draw the pixels of a line between x1 and x2 (inclusive, any order) on row y.
+  void line_run_(int x1, int x2, int y, Color color);
 
   DisplayRotation rotation_{DISPLAY_ROTATION_0_DEGREES};
   optional<display_writer_t> writer_{};
@@ -1,7 +1,9 @@
 #include "display_buffer.h"
 
+#include <algorithm>
 #include <utility>
 
+#include "display_color_utils.h"
 #include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
@@ -20,6 +22,77 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   this->clear();
 }
 
+void DisplayBuffer::init_dirty_tiles_(uint8_t tile_shift) {
+  const int tile_size = 1 << tile_shift;
+  this->tile_shift_ = tile_shift;
+  this->tiles_x_ = (this->get_width_internal() + tile_size - 1) >> tile_shift;
+  this->tiles_y_ = (this->get_height_internal() + tile_size - 1) >> tile_shift;
+  this->dirty_tiles_.assign(size_t(this->tiles_x_) * this->tiles_y_, 0);
+}
+
+void DisplayBuffer::mark_all_dirty_() { std::fill(this->dirty_tiles_.begin(), this->dirty_tiles_.end(), 1); }
+
+void DisplayBuffer::flush_dirty_regions_(size_t max_regions) {
+  // merge dirty tiles into rectangles, in tiles: runs on a row, then runs covering the same columns on the next rows
+  std::vector<Rect> regions;
+  for (int ty = 0; ty < this->tiles_y_; ty++) {
+    const uint8_t *row = &this->dirty_tiles_[ty * this->tiles_x_];
+    int tx = 0;
+    while (tx < this->tiles_x_) {
+      if (!row[tx]) {
+        tx++;
+        continue;
+      }
+      const int start = tx;
+      while (tx < this->tiles_x_ && row[tx])
+        tx++;
+      bool merged = false;
+      for (auto &region : regions) {
+        if (region.x == start && region.w == tx - start && region.y2() == ty) {
+          region.h++;
+          merged = true;
+          break;
+        }
+      }
+      if (!merged)
+        regions.emplace_back(start, ty, tx - start, 1);
+    }
+  }
+  if (regions.empty())
+    return;
+  std::fill(this->dirty_tiles_.begin(), this->dirty_tiles_.end(), 0);
+
+  // too many regions cost more in transfer overhead than the clean tiles between them, join the closest pairs
+  while (regions.size() > max_regions) {
+    size_t best_a = 0, best_b = 1;
+    int best_waste = INT32_MAX;
+    for (size_t a = 0; a < regions.size(); a++) {
+      for (size_t b = a + 1; b < regions.size(); b++) {
+        Rect joined = regions[a];
+        joined.extend(regions[b]);
+        const int waste = joined.w * joined.h - regions[a].w * regions[a].h - regions[b].w * regions[b].h;
+        if (waste < best_waste) {
+          best_waste = waste;
+          best_a = a;
+          best_b = b;
+        }
+      }
+    }
+    regions[best_a].extend(regions[best_b]);
+    regions.erase(regions.begin() + best_b);
+  }
+
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  for (auto &region : regions) {
+    const int x = region.x << this->tile_shift_;
+    const int y = region.y << this->tile_shift_;
+    const int w = std::min(region.w << this->tile_shift_, width - x);
+    const int h = std::min(region.h << this->tile_shift_, height - y);
+    this->flush_region_(Rect(x, y, w, h));
+  }
+}
+
 int DisplayBuffer::get_width() {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_90_DEGREES:
@@ -68,5 +141,91 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+bool HOT DisplayBuffer::clip_span_(int y, int &x, int &x_end) {
+  // clip the run once, the same way draw_pixel_at() clips each pixel
+  if (y < 0 || y >= this->get_height())
+    return false;
+  x_end = std::min(x_end, this->get_width());
+  x = std::max(x, 0);
+  const Rect clip = this->get_clipping();
+  if (clip.is_set()) {
+    if (y < clip.y || y > clip.y2())
+      return false;
+    x = std::max(x, (int) clip.x);
+    x_end = std::min(x_end, clip.x2() + 1);
+  }
+  return x < x_end;
+}
+
+void HOT DisplayBuffer::fill_span(int x, int y, int w, Color color) {
+  int x_end = x + w;
+  if (!this->clip_span_(y, x, x_end))
+    return;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->draw_absolute_span_internal(x, y, x_end - x, color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      // the run is a native column
+      for (int i = x; i < x_end; i++)
+        this->draw_absolute_pixel_internal(this->get_width_internal() - y - 1, i, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->draw_absolute_span_internal(this->get_width_internal() - x_end, this->get_height_internal() - y - 1,
+                                        x_end - x, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      for (int i = x; i < x_end; i++)
+        this->draw_absolute_pixel_internal(y, this->get_height_internal() - i - 1, color);
+      break;
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::draw_absolute_span_internal(int x, int y, int w, Color color) {
+  for (int i = x; i < x + w; i++)
+    this->draw_absolute_pixel_internal(i, y, color);
+}
+
+void HOT DisplayBuffer::blit_span_565(int x, int y, int w, const uint8_t *data) {
+  int x_end = x + w;
+  const int x_start = x;
+  if (!this->clip_span_(y, x, x_end))
+    return;
+  data += (x - x_start) * 2;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->draw_absolute_span_565_internal(x, y, x_end - x, data);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      for (int i = x; i < x_end; i++, data += 2) {
+        this->draw_absolute_pixel_internal(this->get_width_internal() - y - 1, i,
+                                           ColorUtil::rgb565_to_color(encode_uint16(data[0], data[1])));
+      }
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      // the run is a native row, but reversed
+      for (int i = x; i < x_end; i++, data += 2) {
+        this->draw_absolute_pixel_internal(this->get_width_internal() - i - 1, this->get_height_internal() - y - 1,
+                                           ColorUtil::rgb565_to_color(encode_uint16(data[0], data[1])));
+      }
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      for (int i = x; i < x_end; i++, data += 2) {
+        this->draw_absolute_pixel_internal(y, this->get_height_internal() - i - 1,
+                                           ColorUtil::rgb565_to_color(encode_uint16(data[0], data[1])));
+      }
+      break;
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::draw_absolute_span_565_internal(int x, int y, int w, const uint8_t *data) {
+  for (int i = x; i < x + w; i++, data += 2)
+    this->draw_absolute_pixel_internal(i, y, ColorUtil::rgb565_to_color(encode_uint16(data[0], data[1])));
+}
+
 }  // namespace display
 }  // namespace esphome
@@ -22,12 +22,49 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  /// Set a horizontal run of pixels, clipping and rotating it once for the whole run.
+  void fill_span(int x, int y, int w, Color color) override;
+  /// Set a horizontal run of RGB565 pixels, clipping and rotating it once for the whole run.
+  void blit_span_565(int x, int y, int w, const uint8_t *data) override;
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
+  /** Set w pixels of native row y starting at x, the run is already clipped to the display.
+   *
+   * Override this to write the run straight into the buffer, the default draws each pixel.
+   */
+  virtual void draw_absolute_span_internal(int x, int y, int w, Color color);
+  /// Set w pixels of native row y starting at x from big-endian RGB565 data, the run is already clipped.
+  virtual void draw_absolute_span_565_internal(int x, int y, int w, const uint8_t *data);
+
+  /// Clip the run [x, x_end) on row y to the display and the clipping rectangle, false if nothing is left.
+  bool clip_span_(int y, int &x, int &x_end);
 
   void init_internal_(uint32_t buffer_length);
 
+  /** Track which parts of the buffer changed, in square tiles of (1 << tile_shift) native pixels.
+   *
+   * Drivers opting in call this once the native size is known, mark the pixels they change with mark_dirty_() and
+   * write out only the changed regions with flush_dirty_regions_(), which calls flush_region_() for each of them.
+   */
+  void init_dirty_tiles_(uint8_t tile_shift = 4);
+  /// Mark the native pixel [x,y] as changed.
+  inline void mark_dirty_(int x, int y) {
+    if (!this->dirty_tiles_.empty())
+      this->dirty_tiles_[(y >> this->tile_shift_) * this->tiles_x_ + (x >> this->tile_shift_)] = 1;
+  }
+  /// Mark the whole buffer as changed.
+  void mark_all_dirty_();
+  /// Merge the changed tiles into at most max_regions rectangles, flush each and start tracking anew.
+  void flush_dirty_regions_(size_t max_regions = 8);
+  /// Write the native region of the buffer to the display, used by flush_dirty_regions_().
+  virtual void flush_region_(const Rect &region) {}
+
   uint8_t *buffer_{nullptr};
+  std::vector<uint8_t> dirty_tiles_{};
+  uint16_t tiles_x_{0};
+  uint16_t tiles_y_{0};
+  uint8_t tile_shift_{4};
 };
 
 }  // namespace display
@@ -69,6 +69,13 @@ class ColorUtil {
   static inline Color rgb332_to_color(uint8_t rgb332_color) {
     return to_color((uint32_t) rgb332_color, COLOR_ORDER_RGB, COLOR_BITNESS_332);
   }
+  /// Expand an RGB565 value to an opaque Color, replicating the top bits into the low ones so 0x1F maps to 0xFF.
+  static inline Color rgb565_to_color(uint16_t rgb565) {
+    uint8_t r = (rgb565 >> 11) & 0x1F;
+    uint8_t g = (rgb565 >> 5) & 0x3F;
+    uint8_t b = rgb565 & 0x1F;
+    return Color((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 0xFF);
+  }
   static uint8_t color_to_332(Color color, ColorOrder color_order = ColorOrder::COLOR_ORDER_RGB) {
     uint16_t red_color, green_color, blue_color;
 
@@ -3,9 +3,12 @@
 #include "esphome/core/preferences.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include <esp_rom_crc.h>
 #include <nvs_flash.h>
+#include <algorithm>
 #include <cstring>
 #include <cinttypes>
+#include <map>
 #include <vector>
 #include <string>
 
@@ -14,43 +17,77 @@ namespace esp32 {
 
 static const char *const TAG = "esp32.preferences";
 
-struct NVSData {
-  std::string key;
-  std::vector<uint8_t> data;
+class ESP32PreferenceBackend;
+
+/// What is known about one NVS key, shared by all backends created for it
+struct NVSKeyState {
+  /// CRC and length of the data in NVS, if `known` is set
+  uint32_t crc{0};
+  size_t len{0};
+  bool known{false};
+  /// Backends of this key with a save that is not in NVS yet
+  uint16_t pending{0};
+
+  bool matches(uint32_t crc, size_t len) const { return this->known && this->crc == crc && this->len == len; }
+  void set(uint32_t crc, size_t len) {
+    this->crc = crc;
+    this->len = len;
+    this->known = true;
+  }
 };
 
-static std::vector<NVSData> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+// Backends with a save that still has to go through sync()
+static std::vector<ESP32PreferenceBackend *> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+// Orders saves of backends that share a key
+static uint32_t s_save_seq = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static std::map<std::string, NVSKeyState> s_key_states;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 class ESP32PreferenceBackend : public ESPPreferenceBackend {
  public:
   std::string key;
   uint32_t nvs_handle;
+  NVSKeyState *stored;
+  /// Data of the last save while `pending` is set, written to NVS by the next sync()
+  std::vector<uint8_t> data;
+  uint32_t data_crc{0};
+  bool pending{false};
+  /// Whether this backend is in s_pending_save
+  bool queued{false};
+  /// When the last save happened, relative to saves of other backends
+  uint32_t save_seq{0};
+
   bool save(const uint8_t *data, size_t len) override {
-    // try find in pending saves and update that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        obj.data.assign(data, data + len);
-        return true;
-      }
+    uint32_t crc = esp_rom_crc32_le(0, data, len);
+    this->save_seq = ++s_save_seq;
+    if (this->stored->matches(crc, len) && this->stored->pending == (this->pending ? 1 : 0)) {
+      // back to what is in flash and no other backend of the key has a save waiting, nothing to write
+      this->clear_pending();
+      return true;
+    }
+    if (this->pending && this->data_crc == crc && this->data.size() == len)
+      return true;
+    this->data.assign(data, data + len);
+    this->data_crc = crc;
+    if (!this->pending) {
+      this->pending = true;
+      this->stored->pending++;
+    }
+    if (!this->queued) {
+      this->queued = true;
+      s_pending_save.push_back(this);
     }
-    NVSData save{};
-    save.key = key;
-    save.data.assign(data, data + len);
-    s_pending_save.emplace_back(save);
     ESP_LOGVV(TAG, "s_pending_save: key: %s, len: %d", key.c_str(), len);
     return true;
   }
   bool load(uint8_t *data, size_t len) override {
-    // try find in pending saves and load from that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        if (obj.data.size() != len) {
-          // size mismatch
-          return false;
-        }
-        memcpy(data, obj.data.data(), len);
-        return true;
+    // a pending save is newer than what is in NVS
+    if (this->pending) {
+      if (this->data.size() != len) {
+        // size mismatch
+        return false;
       }
+      memcpy(data, this->data.data(), len);
+      return true;
     }
 
     size_t actual_len;
@@ -70,8 +107,19 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
     } else {
       ESP_LOGVV(TAG, "nvs_get_blob: key: %s, len: %d", key.c_str(), len);
     }
+    this->stored->set(esp_rom_crc32_le(0, data, len), len);
     return true;
   }
+
+  void clear_pending() {
+    if (!this->pending)
+      return;
+    this->pending = false;
+    this->stored->pending--;
+    // only needed again by the next save
+    this->data.clear();
+    this->data.shrink_to_fit();
+  }
 };
 
 class ESP32Preferences : public ESPPreferences {
@@ -103,6 +151,7 @@ class ESP32Preferences : public ESPPreferences {
 
     uint32_t keyval = type;
     pref->key = str_sprintf("%" PRIu32, keyval);
+    pref->stored = &s_key_states[pref->key];
 
     return ESPPreferenceObject(pref);
   }
@@ -117,30 +166,65 @@ class ESP32Preferences : public ESPPreferences {
     esp_err_t last_err = ESP_OK;
     std::string last_key{};
 
+    // Backends created for the same key would overwrite each other, only their most recent save is written
+    std::sort(s_pending_save.begin(), s_pending_save.end(),
+              [](const ESP32PreferenceBackend *a, const ESP32PreferenceBackend *b) {
+                if (a->key != b->key)
+                  return a->key < b->key;
+                return a->save_seq < b->save_seq;
+              });
+    const ESP32PreferenceBackend *newer = nullptr;
+
     // go through vector from back to front (makes erase easier/more efficient)
     for (ssize_t i = s_pending_save.size() - 1; i >= 0; i--) {
-      const auto &save = s_pending_save[i];
-      ESP_LOGVV(TAG, "Checking if NVS data %s has changed", save.key.c_str());
-      if (is_changed(nvs_handle, save)) {
-        esp_err_t err = nvs_set_blob(nvs_handle, save.key.c_str(), save.data.data(), save.data.size());
-        ESP_LOGV(TAG, "sync: key: %s, len: %d", save.key.c_str(), save.data.size());
-        if (err != 0) {
-          ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", save.key.c_str(), save.data.size(),
-                   esp_err_to_name(err));
-          failed++;
-          last_err = err;
-          last_key = save.key;
-          continue;
+      auto *save = s_pending_save[i];
+      if (newer != nullptr && newer->key == save->key) {
+        // superseded by a later save to the same key
+        save->clear_pending();
+        cached++;
+        save->queued = false;
+        s_pending_save.erase(s_pending_save.begin() + i);
+        continue;
+      }
+      newer = save;
+      if (save->pending) {
+        ESP_LOGVV(TAG, "Checking if NVS data %s has changed", save->key.c_str());
+        bool changed = save->stored->known ? !save->stored->matches(save->data_crc, save->data.size())
+                                           : is_changed(nvs_handle, save);
+        if (changed) {
+          esp_err_t err = nvs_set_blob(nvs_handle, save->key.c_str(), save->data.data(), save->data.size());
+          ESP_LOGV(TAG, "sync: key: %s, len: %d", save->key.c_str(), save->data.size());
+          if (err != 0) {
+            ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", save->key.c_str(), save->data.size(),
+                     esp_err_to_name(err));
+            failed++;
+            // the key may be partly written
+            save->stored->known = false;
+            last_err = err;
+            last_key = save->key;
+            continue;
+          }
+          written++;
+          this->sync_stats_.writes++;
+          this->sync_stats_.bytes_written += save->data.size();
+        } else {
+          ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%u", save->key.c_str(), save->data.size());
+          cached++;
         }
-        written++;
+        save->stored->set(save->data_crc, save->data.size());
+        save->clear_pending();
       } else {
-        ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%u", save.key.c_str(), save.data.size());
+        // saved back to the data in flash before this sync
         cached++;
       }
+      save->queued = false;
       s_pending_save.erase(s_pending_save.begin() + i);
     }
+    this->sync_stats_.skipped += cached;
     ESP_LOGD(TAG, "Saving %d preferences to flash: %d cached, %d written, %d failed", cached + written + failed, cached,
              written, failed);
+    ESP_LOGD(TAG, "Since boot: %" PRIu32 " writes (%" PRIu32 " bytes), %" PRIu32 " skipped", this->sync_stats_.writes,
+             this->sync_stats_.bytes_written, this->sync_stats_.skipped);
     if (failed > 0) {
       ESP_LOGE(TAG, "Error saving %d preferences to flash. Last error=%s for key=%s", failed, esp_err_to_name(last_err),
                last_key.c_str());
@@ -155,26 +239,35 @@ class ESP32Preferences : public ESPPreferences {
 
     return failed == 0;
   }
-  bool is_changed(const uint32_t nvs_handle, const NVSData &to_save) {
-    NVSData stored_data{};
+  /// Compare with NVS for backends whose data in flash is not known yet, because they were saved without a load.
+  bool is_changed(const uint32_t nvs_handle, const ESP32PreferenceBackend *to_save) {
     size_t actual_len;
-    esp_err_t err = nvs_get_blob(nvs_handle, to_save.key.c_str(), nullptr, &actual_len);
+    esp_err_t err = nvs_get_blob(nvs_handle, to_save->key.c_str(), nullptr, &actual_len);
     if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", to_save.key.c_str(), esp_err_to_name(err));
+      ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", to_save->key.c_str(),
+               esp_err_to_name(err));
       return true;
     }
-    stored_data.data.resize(actual_len);
-    err = nvs_get_blob(nvs_handle, to_save.key.c_str(), stored_data.data.data(), &actual_len);
+    if (actual_len != to_save->data.size())
+      return true;
+    std::vector<uint8_t> stored_data(actual_len);
+    err = nvs_get_blob(nvs_handle, to_save->key.c_str(), stored_data.data(), &actual_len);
     if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", to_save.key.c_str(), esp_err_to_name(err));
+      ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", to_save->key.c_str(), esp_err_to_name(err));
       return true;
     }
-    return to_save.data != stored_data.data;
+    return to_save->data != stored_data;
   }
 
   bool reset() override {
     ESP_LOGD(TAG, "Cleaning up preferences in flash...");
+    for (auto *save : s_pending_save) {
+      save->clear_pending();
+      save->queued = false;
+    }
     s_pending_save.clear();
+    for (auto &it : s_key_states)
+      it.second.known = false;
 
     nvs_flash_deinit();
     nvs_flash_erase();
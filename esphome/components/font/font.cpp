@@ -1,5 +1,7 @@
 #include "font.h"
 
+#include <cstring>
+
 #include "esphome/core/color.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -48,10 +50,25 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
 Font::Font(const GlyphData *data, int data_nr, int baseline, int height, uint8_t bpp)
     : baseline_(baseline), height_(height), bpp_(bpp) {
   glyphs_.reserve(data_nr);
-  for (int i = 0; i < data_nr; ++i)
+  memset(this->ascii_glyphs_, NO_GLYPH, sizeof(this->ascii_glyphs_));
+  for (int i = 0; i < data_nr; ++i) {
     glyphs_.emplace_back(&data[i]);
+    const uint8_t *a_char = data[i].a_char;
+    if (a_char[0] < 0x80 && a_char[1] == '\0' && i < NO_GLYPH)
+      this->ascii_glyphs_[a_char[0]] = i;
+  }
 }
 int Font::match_next_glyph(const uint8_t *str, int *match_length) {
+  if (*str < 0x80) {
+    // ASCII is looked up directly, no need to search
+    const uint8_t glyph_n = this->ascii_glyphs_[*str];
+    if (glyph_n == NO_GLYPH) {
+      *match_length = 0;
+      return -1;
+    }
+    *match_length = 1;
+    return glyph_n;
+  }
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -100,6 +117,22 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
   *x_offset = min_x;
   *width = x - min_x;
 }
+void Font::draw_run_(display::Display *display, int x, int y, int width, uint8_t pixel, Color color,
+                     Color background) {
+  if (pixel == 0 || width == 0)
+    return;
+  const uint8_t bpp_max = (1 << this->bpp_) - 1;
+  if (pixel == bpp_max) {
+    display->fill_span(x, y, width, color);
+    return;
+  }
+  // blend color and background in fixed point
+  const uint16_t on = pixel;
+  const uint16_t off = bpp_max - pixel;
+  auto blended = Color((color.r * on + background.r * off) / bpp_max, (color.g * on + background.g * off) / bpp_max,
+                       (color.b * on + background.b * off) / bpp_max, (color.w * on + background.w * off) / bpp_max);
+  display->fill_span(x, y, width, blended);
+}
 void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text, Color background) {
   int i = 0;
   int x_at = x_start;
@@ -124,22 +157,17 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
 
     const uint8_t *data = glyph.glyph_data_->data;
-    const int max_x = x_at + scan_x1 + scan_width;
+    const int min_x = x_at + scan_x1;
+    const int max_x = min_x + scan_width;
     const int max_y = y_start + scan_y1 + scan_height;
 
     uint8_t bitmask = 0;
     uint8_t pixel_data = 0;
-    uint8_t bpp_max = (1 << this->bpp_) - 1;
-    auto diff_r = (float) color.r - (float) background.r;
-    auto diff_g = (float) color.g - (float) background.g;
-    auto diff_b = (float) color.b - (float) background.b;
-    auto diff_w = (float) color.w - (float) background.w;
-    auto b_r = (float) background.r;
-    auto b_g = (float) background.g;
-    auto b_b = (float) background.b;
-    auto b_w = (float) background.w;
     for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
-      for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
+      // pixels with the same value are drawn together as a span
+      int run_x = min_x;
+      uint8_t run_pixel = 0;
+      for (int glyph_x = min_x; glyph_x != max_x; glyph_x++) {
         uint8_t pixel = 0;
         for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
           if (bitmask == 0) {
@@ -151,15 +179,13 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
             pixel |= 1;
           bitmask >>= 1;
         }
-        if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
-          auto on = (float) pixel / (float) bpp_max;
-          auto blended = Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g),
-                               (uint8_t) (diff_b * on + b_b), (uint8_t) (diff_w * on + b_w));
-          display->draw_pixel_at(glyph_x, glyph_y, blended);
+        if (pixel != run_pixel) {
+          this->draw_run_(display, run_x, glyph_y, glyph_x - run_x, run_pixel, color, background);
+          run_x = glyph_x;
+          run_pixel = pixel;
         }
       }
+      this->draw_run_(display, run_x, glyph_y, max_x - run_x, run_pixel, color, background);
     }
     x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
 
@@ -69,7 +69,16 @@ class Font
   const std::vector<Glyph, ExternalRAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
  protected:
+#ifdef USE_DISPLAY
+  /// Draw width pixels of glyph value pixel, blending color and background for antialiased values.
+  void draw_run_(display::Display *display, int x, int y, int width, uint8_t pixel, Color color, Color background);
+#endif
+
+  static const uint8_t NO_GLYPH = 0xFF;
+
   std::vector<Glyph, ExternalRAMAllocator<Glyph>> glyphs_;
+  /// Glyph index of each ASCII character or NO_GLYPH, these sort first so always fit a byte.
+  uint8_t ascii_glyphs_[128];
   int baseline_;
   int height_;
   uint8_t bpp_;  // bits per pixel
@@ -1,9 +1,16 @@
 #ifdef USE_HOST
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
 #include <filesystem>
-#include <fstream>
 #include "preferences.h"
 #include "esphome/core/application.h"
+#include "esphome/core/log.h"
 
 namespace esphome {
 namespace host {
@@ -11,9 +18,24 @@ namespace fs = std::filesystem;
 
 static const char *const TAG = "host.preferences";
 
+static const uint8_t LOG_MAGIC[4] = {'E', 'P', 'L', '1'};
+/// Don't compact logs smaller than this, however many outdated records they contain
+static const size_t COMPACT_MIN_SIZE = 4096;
+
+static uint32_t record_checksum(const uint8_t *data, size_t len) {
+  // FNV-1a
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
 void HostPreferences::setup_() {
   if (this->setup_complete_)
     return;
+  this->setup_complete_ = true;
   this->filename_.append(getenv("HOME"));
   this->filename_.append("/.esphome");
   this->filename_.append("/prefs");
@@ -21,43 +43,157 @@ void HostPreferences::setup_() {
   this->filename_.append("/");
   this->filename_.append(App.get_name());
   this->filename_.append(".prefs");
-  FILE *fp = fopen(this->filename_.c_str(), "rb");
-  if (fp != nullptr) {
-    while (!feof((fp))) {
-      uint32_t key;
-      uint8_t len;
-      if (fread(&key, sizeof(key), 1, fp) != 1)
-        break;
-      if (fread(&len, sizeof(len), 1, fp) != 1)
-        break;
-      uint8_t data[len];
-      if (fread(data, sizeof(uint8_t), len, fp) != len)
-        break;
-      std::vector vec(data, data + len);
-      this->data[key] = vec;
+
+  int fd = open(this->filename_.c_str(), O_RDONLY);
+  if (fd < 0)
+    return;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    return;
+  }
+  const size_t size = st.st_size;
+  void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    ESP_LOGE(TAG, "Unable to map %s", this->filename_.c_str());
+    return;
+  }
+  const auto *file = static_cast<const uint8_t *>(map);
+  bool compact = false;
+  if (size >= sizeof(LOG_MAGIC) && memcmp(file, LOG_MAGIC, sizeof(LOG_MAGIC)) == 0) {
+    this->file_size_ = this->read_log_(file, size);
+    if (this->file_size_ != size) {
+      ESP_LOGW(TAG, "Dropping %zu bytes of incomplete records", size - this->file_size_);
+      compact = true;
     }
-    fclose(fp);
+  } else {
+    this->read_legacy_(file, size);
+    compact = true;
+  }
+  munmap(map, size);
+  if (compact)
+    this->compact_();
+}
+
+size_t HostPreferences::read_log_(const uint8_t *file, size_t size) {
+  size_t at = sizeof(LOG_MAGIC);
+  while (at + record_size(0) <= size) {
+    const uint8_t len = file[at + sizeof(uint32_t)];
+    const size_t rec_size = record_size(len);
+    if (at + rec_size > size)
+      break;
+    uint32_t key, checksum;
+    memcpy(&key, file + at, sizeof(key));
+    memcpy(&checksum, file + at + rec_size - sizeof(checksum), sizeof(checksum));
+    if (record_checksum(file + at, rec_size - sizeof(checksum)) != checksum)
+      break;
+    const uint8_t *data = file + at + sizeof(key) + 1;
+    this->data_[key].assign(data, data + len);
+    at += rec_size;
+  }
+  return at;
+}
+
+void HostPreferences::read_legacy_(const uint8_t *file, size_t size) {
+  size_t at = 0;
+  while (at + sizeof(uint32_t) + 1 <= size) {
+    uint32_t key;
+    memcpy(&key, file + at, sizeof(key));
+    const uint8_t len = file[at + sizeof(key)];
+    const uint8_t *data = file + at + sizeof(key) + 1;
+    if (data + len > file + size)
+      break;
+    this->data_[key].assign(data, data + len);
+    at += sizeof(key) + 1 + len;
   }
-  this->setup_complete_ = true;
+}
+
+void HostPreferences::append_record(std::vector<uint8_t> &out, uint32_t key, const std::vector<uint8_t> &data) {
+  const size_t start = out.size();
+  out.resize(start + record_size(data.size()));
+  uint8_t *rec = &out[start];
+  memcpy(rec, &key, sizeof(key));
+  rec[sizeof(key)] = data.size();
+  memcpy(rec + sizeof(key) + 1, data.data(), data.size());
+  const uint32_t checksum = record_checksum(rec, sizeof(key) + 1 + data.size());
+  memcpy(rec + sizeof(key) + 1 + data.size(), &checksum, sizeof(checksum));
+}
+
+static bool write_file(FILE *fp, const std::vector<uint8_t> &buf) {
+  if (fwrite(buf.data(), 1, buf.size(), fp) != buf.size())
+    return false;
+  if (fflush(fp) != 0)
+    return false;
+  return fsync(fileno(fp)) == 0;
+}
+
+bool HostPreferences::compact_() {
+  std::vector<uint8_t> buf(LOG_MAGIC, LOG_MAGIC + sizeof(LOG_MAGIC));
+  for (auto &it : this->data_)
+    append_record(buf, it.first, it.second);
+
+  // write a new file and move it over the old one, so a crash leaves either of them intact
+  const std::string tmp = this->filename_ + ".tmp";
+  FILE *fp = fopen(tmp.c_str(), "wb");
+  if (fp == nullptr) {
+    ESP_LOGE(TAG, "Unable to open %s", tmp.c_str());
+    return false;
+  }
+  bool ok = write_file(fp, buf);
+  fclose(fp);
+  if (!ok || rename(tmp.c_str(), this->filename_.c_str()) != 0) {
+    ESP_LOGE(TAG, "Unable to write %s", this->filename_.c_str());
+    return false;
+  }
+  this->file_size_ = buf.size();
+  return true;
 }
 
 bool HostPreferences::sync() {
   this->setup_();
-  FILE *fp = fopen(this->filename_.c_str(), "wb");
-  std::map<uint32_t, std::vector<uint8_t>>::iterator it;
-
-  for (it = this->data.begin(); it != this->data.end(); ++it) {
-    fwrite(&it->first, sizeof(uint32_t), 1, fp);
-    uint8_t len = it->second.size();
-    fwrite(&len, sizeof(len), 1, fp);
-    fwrite(it->second.data(), sizeof(uint8_t), it->second.size(), fp);
+  if (this->pending_.empty() && !this->cleared_)
+    return true;
+
+  std::vector<uint8_t> buf;
+  size_t live_size = sizeof(LOG_MAGIC);
+  for (auto &it : this->data_)
+    live_size += record_size(it.second.size());
+  for (uint32_t key : this->pending_) {
+    const auto &data = this->data_[key];
+    append_record(buf, key, data);
+    this->sync_stats_.writes++;
+    this->sync_stats_.bytes_written += data.size();
+  }
+  this->pending_.clear();
+  ESP_LOGV(TAG, "Since boot: %" PRIu32 " writes (%" PRIu32 " bytes), %" PRIu32 " skipped", this->sync_stats_.writes,
+           this->sync_stats_.bytes_written, this->sync_stats_.skipped);
+
+  if (this->cleared_ || this->file_size_ == 0 ||
+      this->file_size_ + buf.size() > std::max(2 * live_size, COMPACT_MIN_SIZE)) {
+    this->cleared_ = false;
+    return this->compact_();
+  }
+
+  FILE *fp = fopen(this->filename_.c_str(), "ab");
+  if (fp == nullptr) {
+    ESP_LOGE(TAG, "Unable to open %s", this->filename_.c_str());
+    return false;
   }
+  bool ok = write_file(fp, buf);
   fclose(fp);
+  if (!ok) {
+    // the partial record is dropped on the next start, rewrite to keep later appends readable
+    return this->compact_();
+  }
+  this->file_size_ += buf.size();
   return true;
 }
 
 bool HostPreferences::reset() {
-  host_preferences->data.clear();
+  host_preferences->data_.clear();
+  host_preferences->pending_.clear();
+  host_preferences->cleared_ = true;
   return true;
 }
 
@@ -3,7 +3,11 @@
 #ifdef USE_HOST
 
 #include "esphome/core/preferences.h"
-#include <map>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace esphome {
 namespace host {
@@ -19,6 +23,12 @@ class HostPreferenceBackend : public ESPPreferenceBackend {
   uint32_t key_{};
 };
 
+/** Preferences stored in an append-only log file.
+ *
+ * Every sync appends a checksummed record per changed key, the latest record of a key wins when the file is read back.
+ * Records cut short by a crash are dropped on the next start. Once the file holds mostly outdated records it is
+ * compacted into a new file that replaces the old one atomically.
+ */
 class HostPreferences : public ESPPreferences {
  public:
   bool sync() override;
@@ -33,8 +43,15 @@ class HostPreferences : public ESPPreferences {
     if (len > 255)
       return false;
     this->setup_();
-    std::vector vec(data, data + len);
-    this->data[key] = vec;
+    auto &stored = this->data_[key];
+    if (stored.size() == len && memcmp(stored.data(), data, len) == 0) {
+      // unchanged, only counted as skipped if there is no other save pending for this key
+      if (this->pending_.count(key) == 0)
+        this->sync_stats_.skipped++;
+      return true;
+    }
+    stored.assign(data, data + len);
+    this->pending_.insert(key);
     return true;
   }
 
@@ -42,20 +59,33 @@ class HostPreferences : public ESPPreferences {
     if (len > 255)
       return false;
     this->setup_();
-    if (this->data.count(key) == 0)
+    auto it = this->data_.find(key);
+    if (it == this->data_.end() || it->second.size() != len)
       return false;
-    auto vec = this->data[key];
-    if (vec.size() != len)
-      return false;
-    memcpy(data, vec.data(), len);
+    memcpy(data, it->second.data(), len);
     return true;
   }
 
  protected:
   void setup_();
+  /// Read the records of the log file, returns the length of the valid part.
+  size_t read_log_(const uint8_t *file, size_t size);
+  /// Read a file written before the log format, it is compacted into a log right after.
+  void read_legacy_(const uint8_t *file, size_t size);
+  /// Rewrite the file with only the current record of each key.
+  bool compact_();
+  static size_t record_size(size_t len) { return sizeof(uint32_t) + 1 + len + sizeof(uint32_t); }
+  static void append_record(std::vector<uint8_t> &out, uint32_t key, const std::vector<uint8_t> &data);
+
   bool setup_complete_{};
   std::string filename_{};
-  std::map<uint32_t, std::vector<uint8_t>> data{};
+  std::unordered_map<uint32_t, std::vector<uint8_t>> data_{};
+  /// Keys saved since the last sync
+  std::unordered_set<uint32_t> pending_{};
+  /// Set by reset(), the file has to be rewritten even without pending saves
+  bool cleared_{false};
+  /// Size of the log file, including records that were replaced by later ones
+  size_t file_size_{0};
 };
 void setup_preferences();
 extern HostPreferences *host_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
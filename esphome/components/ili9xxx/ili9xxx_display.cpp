@@ -204,6 +204,87 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
   }
 }
 
+void HOT ILI9XXXDisplay::draw_absolute_span_internal(int x, int y, int w, Color color) {
+  if (!this->check_buffer_())
+    return;
+  int first = 0;
+  int last = w - 1;
+  if (this->buffer_color_mode_ == BITS_16) {
+    const uint16_t new_color = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+    const uint8_t high = new_color >> 8;
+    const uint8_t low = new_color & 0xFF;
+    uint8_t *row = this->buffer_ + ((y * this->width_) + x) * 2;
+    // only the changed part of the run moves the watermarks
+    while (first <= last && row[first * 2] == high && row[first * 2 + 1] == low)
+      first++;
+    if (first > last)
+      return;
+    while (row[last * 2] == high && row[last * 2 + 1] == low)
+      last--;
+    if (high == low) {
+      memset(row + first * 2, high, (last - first + 1) * 2);
+    } else {
+      for (int i = first; i <= last; i++) {
+        row[i * 2] = high;
+        row[i * 2 + 1] = low;
+      }
+    }
+  } else {
+    uint8_t new_color;
+    if (this->buffer_color_mode_ == BITS_8_INDEXED) {
+      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+    } else {
+      new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+    }
+    uint8_t *row = this->buffer_ + (y * this->width_) + x;
+    while (first <= last && row[first] == new_color)
+      first++;
+    if (first > last)
+      return;
+    while (row[last] == new_color)
+      last--;
+    memset(row + first, new_color, last - first + 1);
+  }
+
+  if (x + first < this->x_low_)
+    this->x_low_ = x + first;
+  if (y < this->y_low_)
+    this->y_low_ = y;
+  if (x + last > this->x_high_)
+    this->x_high_ = x + last;
+  if (y > this->y_high_)
+    this->y_high_ = y;
+}
+
+void HOT ILI9XXXDisplay::draw_absolute_span_565_internal(int x, int y, int w, const uint8_t *data) {
+  if (this->buffer_color_mode_ != BITS_16) {
+    display::DisplayBuffer::draw_absolute_span_565_internal(x, y, w, data);
+    return;
+  }
+  if (!this->check_buffer_())
+    return;
+  // the buffer holds big-endian RGB565 as well, copy the changed part of the run as is
+  uint8_t *row = this->buffer_ + ((y * this->width_) + x) * 2;
+  int first = 0;
+  int last = w - 1;
+  while (first <= last && memcmp(row + first * 2, data + first * 2, 2) == 0)
+    first++;
+  if (first > last)
+    return;
+  while (memcmp(row + last * 2, data + last * 2, 2) == 0)
+    last--;
+  memcpy(row + first * 2, data + first * 2, (last - first + 1) * 2);
+
+  if (x + first < this->x_low_)
+    this->x_low_ = x + first;
+  if (y < this->y_low_)
+    this->y_low_ = y;
+  if (x + last > this->x_high_)
+    this->x_high_ = x + last;
+  if (y > this->y_high_)
+    this->y_high_ = y;
+}
+
 void ILI9XXXDisplay::update() {
   if (this->prossing_update_) {
     this->need_update_ = true;
@@ -106,6 +106,8 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   }
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void draw_absolute_span_internal(int x, int y, int w, Color color) override;
+  void draw_absolute_span_565_internal(int x, int y, int w, const uint8_t *data) override;
   void setup_pins_();
 
   virtual void set_madctl();
@@ -2,28 +2,40 @@
 
 #include "esphome/core/hal.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace image {
 
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
+  // walk the data row by row as it is stored, and hand runs of pixels to the display where possible
   switch (type_) {
     case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
+      const uint32_t stride = this->get_width_stride();
+      for (int img_y = 0; img_y < this->height_; img_y++) {
+        const uint8_t *row = this->data_start_ + img_y * stride;
+        int run_start = 0;
+        bool run_on = progmem_read_byte(row) & 0x80;
+        for (int img_x = 1; img_x <= this->width_; img_x++) {
+          bool on = img_x < this->width_ && (progmem_read_byte(row + img_x / 8u) & (0x80 >> (img_x % 8u)));
+          if (img_x < this->width_ && on == run_on)
+            continue;
+          if (run_on) {
+            display->fill_span(x + run_start, y + img_y, img_x - run_start, color_on);
           } else if (!this->transparency_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
+            display->fill_span(x + run_start, y + img_y, img_x - run_start, color_off);
           }
+          run_start = img_x;
+          run_on = on;
         }
       }
       break;
     }
     case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          const uint32_t pos = (img_x + img_y * this->width_);
-          const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
+      for (int img_y = 0; img_y < this->height_; img_y++) {
+        const uint8_t *pos = this->data_start_ + img_y * this->width_;
+        for (int img_x = 0; img_x < this->width_; img_x++, pos++) {
+          const uint8_t gray = progmem_read_byte(pos);
           Color color = Color(gray, gray, gray, 0xFF);
           switch (this->transparency_) {
             case TRANSPARENCY_CHROMA_KEY:
@@ -32,11 +44,11 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
               }
               break;
             case TRANSPARENCY_ALPHA_CHANNEL: {
-              auto on = (float) gray / 255.0f;
-              auto off = 1.0f - on;
-              // blend color_on and color_off
-              color = Color(color_on.r * on + color_off.r * off, color_on.g * on + color_off.g * off,
-                            color_on.b * on + color_off.b * off, 0xFF);
+              // blend color_on and color_off in fixed point
+              const uint16_t on = gray;
+              const uint16_t off = 255 - gray;
+              color = Color((color_on.r * on + color_off.r * off) / 255, (color_on.g * on + color_off.g * off) / 255,
+                            (color_on.b * on + color_off.b * off) / 255, 0xFF);
               break;
             }
             default:
@@ -47,18 +59,35 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
+      if (this->transparency_ == TRANSPARENCY_ALPHA_CHANNEL) {
+        for (int img_y = 0; img_y < this->height_; img_y++) {
+          for (int img_x = 0; img_x < this->width_; img_x++) {
+            auto color = this->get_rgb565_pixel_(img_x, img_y);
+            if (color.w >= 0x80) {
+              display->draw_pixel_at(x + img_x, y + img_y, color);
+            }
           }
         }
+        break;
+      }
+      // the data is big-endian RGB565 already, blit each run of opaque pixels
+      for (int img_y = 0; img_y < this->height_; img_y++) {
+        const uint8_t *row = this->data_start_ + img_y * this->width_ * 2;
+        int run_start = 0;
+        for (int img_x = 0; img_x <= this->width_; img_x++) {
+          if (img_x < this->width_ && (this->transparency_ != TRANSPARENCY_CHROMA_KEY ||
+                                       progmem_read_byte(row + img_x * 2) != 0x00 ||
+                                       progmem_read_byte(row + img_x * 2 + 1) != 0x20))
+            continue;
+          if (img_x > run_start)
+            this->blit_rgb565_run_(x + run_start, y + img_y, img_x - run_start, row + run_start * 2, display);
+          run_start = img_x + 1;
+        }
       }
       break;
     case IMAGE_TYPE_RGB:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
+      for (int img_y = 0; img_y < this->height_; img_y++) {
+        for (int img_x = 0; img_x < this->width_; img_x++) {
           auto color = this->get_rgb_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -68,6 +97,23 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       break;
   }
 }
+void Image::blit_rgb565_run_(int x, int y, int w, const uint8_t *data, display::Display *display) const {
+#ifdef USE_ESP8266
+  // progmem can only be read a byte at a time here, copy the run out in chunks
+  uint8_t buf[64];
+  while (w > 0) {
+    const int len = std::min(w, (int) sizeof(buf) / 2);
+    for (int i = 0; i != len * 2; i++)
+      buf[i] = progmem_read_byte(data + i);
+    display->blit_span_565(x, y, len, buf);
+    x += len;
+    w -= len;
+    data += len * 2;
+  }
+#else
+  display->blit_span_565(x, y, w, data);
+#endif
+}
 Color Image::get_pixel(int x, int y, const Color color_on, const Color color_off) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return color_off;
@@ -44,6 +44,8 @@ class Image : public display::BaseImage {
   lv_img_dsc_t *get_lv_img_dsc();
 #endif
  protected:
+  /// Draw w pixels of big-endian RGB565 image data at [x,y] in one go.
+  void blit_rgb565_run_(int x, int y, int w, const uint8_t *data, display::Display *display) const;
   bool get_binary_pixel_(int x, int y) const;
   Color get_rgb_pixel_(int x, int y) const;
   Color get_rgb565_pixel_(int x, int y) const;
@@ -79,6 +79,7 @@ DEFAULT = "DEFAULT"
 
 CONF_INITIAL_LEVEL = "initial_level"
 CONF_LOGGER_ID = "logger_id"
+CONF_TASK_LOG_BUFFER_SIZE = "task_log_buffer_size"
 
 UART_SELECTION_ESP32 = {
     VARIANT_ESP32: [UART0, UART1, UART2],
@@ -222,6 +223,9 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(
                 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH, esp8266=True
             ): cv.All(cv.only_on_esp8266, cv.boolean),
+            cv.SplitDefault(CONF_TASK_LOG_BUFFER_SIZE, esp32=2048): cv.All(
+                cv.only_on_esp32, cv.validate_bytes, cv.int_range(min=0, max=32768)
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
@@ -247,6 +251,11 @@ async def to_code(config):
         )
     cg.add(log.pre_setup())
 
+    task_log_buffer_size = config.get(CONF_TASK_LOG_BUFFER_SIZE, 0)
+    if CORE.is_esp32 and task_log_buffer_size > 0:
+        cg.add_define("USE_ESPHOME_TASK_LOG_BUFFER")
+        cg.add(log.init_task_log_buffer(task_log_buffer_size))
+
     for tag, log_level in config[CONF_LOGS].items():
         cg.add(log.set_log_level(tag, LOG_LEVELS[log_level]))
 
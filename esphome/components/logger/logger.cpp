@@ -1,5 +1,7 @@
 #include "logger.h"
+#include <algorithm>
 #include <cinttypes>
+#include <cstring>
 
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -59,7 +61,15 @@ void Logger::write_header_(int level, const char *tag, int line) {
 }
 
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if (level > this->level_for(tag))
+    return;
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  if (this->task_log_buffer_ != nullptr && xTaskGetCurrentTaskHandle() != this->main_task_) {
+    this->log_vprintf_non_main_task_(level, tag, line, format, args);
+    return;
+  }
+#endif
+  if (recursion_guard_)
     return;
 
   recursion_guard_ = true;
@@ -102,8 +112,12 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
 #endif
 
 int HOT Logger::level_for(const char *tag) {
-  if (this->log_levels_.count(tag) != 0)
-    return this->log_levels_[tag];
+  if (this->log_levels_.empty())
+    return this->current_level_;
+  auto it = std::lower_bound(this->log_levels_.begin(), this->log_levels_.end(), tag,
+                             [](const TagLevel &entry, const char *key) { return strcmp(entry.tag.c_str(), key) < 0; });
+  if (it != this->log_levels_.end() && strcmp(it->tag.c_str(), tag) == 0)
+    return it->level;
   return this->current_level_;
 }
 
@@ -142,9 +156,92 @@ Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size) : baud_rate_(baud_rate
 #endif
 }
 
-#ifdef USE_LOGGER_USB_CDC
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+void Logger::init_task_log_buffer(size_t total_size) {
+  // Lines from other tasks are usually short, so cap the slot size to fit more of them in the same memory.
+  const size_t message_size = std::min<size_t>(this->tx_buffer_size_, 255) + 1;
+  this->task_log_buffer_ = make_unique<TaskLogBuffer>(total_size / message_size, message_size);
+}
+uint32_t Logger::get_task_log_dropped() const {
+  if (this->task_log_buffer_ == nullptr)
+    return 0;
+  return this->task_log_buffer_->get_dropped();
+}
+
+void HOT Logger::log_vprintf_non_main_task_(int level, const char *tag, int line, const char *format,
+                                            va_list args) {  // NOLINT
+  // Only format into a slot of the task log buffer here, writing to the UART and the log callbacks is left to the
+  // main loop so this task neither races the main buffer nor blocks on the output.
+  TaskLogBuffer::Slot *slot = this->task_log_buffer_->acquire_write();
+  if (slot == nullptr)
+    return;
+
+  if (level < 0)
+    level = 0;
+  if (level > 7)
+    level = 7;
+  const char *color = LOG_LEVEL_COLORS[level];
+  const int size = this->task_log_buffer_->message_size();
+  char *msg = slot->message;
+  int at = snprintf(msg, size, "%s[%s][%s:%03u]%s[%s]%s: ", color, LOG_LEVEL_LETTERS[level], tag, line,
+                    ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED), pcTaskGetName(nullptr), color);
+  if (at < 0)
+    at = 0;
+  if (at < size) {
+    int ret = vsnprintf(msg + at, size - at, format, args);
+    if (ret > 0)
+      at += ret;
+  }
+  if (at >= size)
+    at = size - 1;
+  // remove trailing newline, make room for the color reset
+  if (at > 0 && msg[at - 1] == '\n')
+    at--;
+  const int footer_len = strlen(ESPHOME_LOG_RESET_COLOR);
+  if (at + footer_len >= size)
+    at = size - 1 - footer_len;
+  memcpy(msg + at, ESPHOME_LOG_RESET_COLOR, footer_len + 1);
+
+  slot->level = level;
+  slot->tag = tag;
+  this->task_log_buffer_->commit_write(slot);
+  this->enable_loop_soon_any_context();
+}
+
+void Logger::process_task_log_buffer_() {
+  TaskLogBuffer::Slot *slot;
+  while ((slot = this->task_log_buffer_->peek_read()) != nullptr) {
+    if (this->baud_rate_ > 0) {
+      this->write_msg_(slot->message);
+    }
+    // See log_message_(), network logging is skipped while memory constrained
+    if (xPortGetFreeHeapSize() >= 2048) {
+      this->log_callback_.call(slot->level, slot->tag, slot->message);
+    }
+    this->task_log_buffer_->release_read(slot);
+  }
+
+  const uint32_t dropped = this->task_log_buffer_->get_dropped();
+  if (dropped != this->task_log_dropped_reported_) {
+    ESP_LOGW(TAG, "Task log buffer full, dropped %" PRIu32 " messages from other tasks",
+             dropped - this->task_log_dropped_reported_);
+    this->task_log_dropped_reported_ = dropped;
+  }
+}
+#endif
+
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_ESPHOME_TASK_LOG_BUFFER)
 void Logger::loop() {
-#ifdef USE_ARDUINO
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  if (this->task_log_buffer_ != nullptr) {
+    this->process_task_log_buffer_();
+  }
+#if !defined(USE_LOGGER_USB_CDC) || !defined(USE_ARDUINO)
+  // Other tasks wake this up again once they log something
+  this->disable_loop();
+#endif
+#endif
+#if defined(USE_LOGGER_USB_CDC) && defined(USE_ARDUINO)
   if (this->uart_ != UART_SELECTION_USB_CDC) {
     return;
   }
@@ -161,7 +258,15 @@ void Logger::loop() {
 #endif
 
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
-void Logger::set_log_level(const std::string &tag, int log_level) { this->log_levels_[tag] = log_level; }
+void Logger::set_log_level(const std::string &tag, int log_level) {
+  auto it = std::lower_bound(this->log_levels_.begin(), this->log_levels_.end(), tag,
+                             [](const TagLevel &entry, const std::string &key) { return entry.tag < key; });
+  if (it != this->log_levels_.end() && it->tag == tag) {
+    it->level = log_level;
+  } else {
+    this->log_levels_.insert(it, TagLevel{tag, log_level});
+  }
+}
 
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_LIBRETINY)
 UARTSelection Logger::get_uart() const { return this->uart_; }
@@ -183,7 +288,7 @@ void Logger::dump_config() {
 #endif
 
   for (auto &it : this->log_levels_) {
-    ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.first.c_str(), LOG_LEVELS[it.second]);
+    ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
 }
 void Logger::write_footer_() { this->write_to_buffer_(ESPHOME_LOG_RESET_COLOR, strlen(ESPHOME_LOG_RESET_COLOR)); }
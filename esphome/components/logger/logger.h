@@ -1,13 +1,17 @@
 #pragma once
 
 #include <cstdarg>
-#include <map>
+#include <vector>
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+#include "task_log_buffer.h"
+#endif
+
 #ifdef USE_ARDUINO
 #if defined(USE_ESP8266) || defined(USE_ESP32)
 #include <HardwareSerial.h>
@@ -57,8 +61,14 @@ enum UARTSelection {
 class Logger : public Component {
  public:
   explicit Logger(uint32_t baud_rate, size_t tx_buffer_size);
-#ifdef USE_LOGGER_USB_CDC
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_ESPHOME_TASK_LOG_BUFFER)
   void loop() override;
+#endif
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  /// Buffer lines logged from other tasks in \p total_size bytes, they are written out by loop().
+  void init_task_log_buffer(size_t total_size);
+  /// Number of lines from other tasks dropped because the task log buffer was full.
+  uint32_t get_task_log_dropped() const;
 #endif
   /// Manually set the baud rate for serial, set to 0 to disable.
   void set_baud_rate(uint32_t baud_rate);
@@ -107,6 +117,10 @@ class Logger : public Component {
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
   void write_msg_(const char *msg);
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  void log_vprintf_non_main_task_(int level, const char *tag, int line, const char *format, va_list args);
+  void process_task_log_buffer_();
+#endif
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -166,13 +180,23 @@ class Logger : public Component {
 #ifdef USE_ESP_IDF
   uart_port_t uart_num_;
 #endif
-  std::map<std::string, int> log_levels_{};
+  struct TagLevel {
+    std::string tag;
+    int level;
+  };
+  /// Levels set for specific tags, sorted by tag so level_for() can look them up without allocating.
+  std::vector<TagLevel> log_levels_{};
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
   int current_level_{ESPHOME_LOG_LEVEL_VERY_VERBOSE};
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
   void *main_task_ = nullptr;
   CallbackManager<void(int)> level_callback_{};
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  std::unique_ptr<TaskLogBuffer> task_log_buffer_{nullptr};
+  /// Dropped lines already reported in the log
+  uint32_t task_log_dropped_reported_{0};
+#endif
 };
 extern Logger *global_logger;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
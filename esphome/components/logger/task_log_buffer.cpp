@@ -0,0 +1,64 @@
+#include "task_log_buffer.h"
+
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+
+namespace esphome {
+namespace logger {
+
+TaskLogBuffer::TaskLogBuffer(size_t slot_count, size_t message_size) : message_size_(message_size) {
+  uint32_t count = 1;
+  while (count * 2 <= slot_count)
+    count *= 2;
+  this->mask_ = count - 1;
+
+  this->slots_ = std::unique_ptr<Slot[]>(new Slot[count]);                     // NOLINT
+  this->messages_ = std::unique_ptr<char[]>(new char[count * message_size]);  // NOLINT
+  for (uint32_t i = 0; i < count; i++) {
+    this->slots_[i].sequence.store(i, std::memory_order_relaxed);
+    this->slots_[i].message = &this->messages_[i * message_size];
+  }
+}
+
+TaskLogBuffer::Slot *TaskLogBuffer::acquire_write() {
+  uint32_t pos = this->write_pos_.load(std::memory_order_relaxed);
+  while (true) {
+    Slot *slot = &this->slots_[pos & this->mask_];
+    uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+    int32_t diff = static_cast<int32_t>(sequence - pos);
+    if (diff == 0) {
+      // slot is free for this position, try to claim it
+      if (this->write_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        return slot;
+      // another writer was faster, pos has been reloaded
+    } else if (diff < 0) {
+      // the reader has not released this slot yet
+      this->dropped_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    } else {
+      pos = this->write_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void TaskLogBuffer::commit_write(Slot *slot) {
+  // the claimed position is one behind the sequence that marks the slot as readable
+  uint32_t pos = slot->sequence.load(std::memory_order_relaxed);
+  slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+TaskLogBuffer::Slot *TaskLogBuffer::peek_read() {
+  Slot *slot = &this->slots_[this->read_pos_ & this->mask_];
+  if (slot->sequence.load(std::memory_order_acquire) != this->read_pos_ + 1)
+    return nullptr;
+  return slot;
+}
+
+void TaskLogBuffer::release_read(Slot *slot) {
+  slot->sequence.store(this->read_pos_ + this->mask_ + 1, std::memory_order_release);
+  this->read_pos_++;
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_ESPHOME_TASK_LOG_BUFFER
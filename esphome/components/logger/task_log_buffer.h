@@ -0,0 +1,61 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace logger {
+
+/** Lock-free ring of formatted log lines from tasks other than the main loop task.
+ *
+ * Any number of tasks may write, only the main loop reads. A writer claims a slot with a compare-and-swap on
+ * the write position and publishes it through the slot's sequence number, so it never blocks and never touches
+ * the logger's own buffer. When all slots are in use the line is dropped and counted.
+ */
+class TaskLogBuffer {
+ public:
+  struct Slot {
+    std::atomic<uint32_t> sequence;
+    uint8_t level;
+    const char *tag;
+    /// Null terminated line, message_size() bytes long including the terminator
+    char *message;
+  };
+
+  /// The slot count is rounded down to a power of two, at least one slot is always allocated.
+  TaskLogBuffer(size_t slot_count, size_t message_size);
+
+  /// Claim a slot to write a line into, returns nullptr if the buffer is full.
+  Slot *acquire_write();
+  /// Hand a slot filled by acquire_write() over to the reader.
+  void commit_write(Slot *slot);
+
+  /// The oldest committed slot, or nullptr if there is none. Main loop only.
+  Slot *peek_read();
+  /// Give the slot returned by peek_read() back to the writers. Main loop only.
+  void release_read(Slot *slot);
+
+  size_t message_size() const { return this->message_size_; }
+  /// Number of lines dropped because the buffer was full, since boot.
+  uint32_t get_dropped() const { return this->dropped_.load(std::memory_order_relaxed); }
+
+ protected:
+  std::unique_ptr<Slot[]> slots_;
+  std::unique_ptr<char[]> messages_;
+  size_t message_size_;
+  uint32_t mask_;
+  std::atomic<uint32_t> write_pos_{0};
+  uint32_t read_pos_{0};
+  std::atomic<uint32_t> dropped_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_ESPHOME_TASK_LOG_BUFFER
@@ -5,11 +5,14 @@
 #include "lvgl_hal.h"
 #include "lvgl_esphome.h"
 
+#include <algorithm>
 #include <numeric>
 
 namespace esphome {
 namespace lvgl {
 static const char *const TAG = "lvgl";
+// side of the square tiles the draw buffer is rotated in
+static const lv_coord_t ROTATE_TILE = 16;
 
 static const char *const EVENT_NAMES[] = {
     "NONE",
@@ -154,9 +157,14 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
   lv_color_t *dst = this->rotate_buf_;
   switch (this->rotation) {
     case display::DISPLAY_ROTATION_90_DEGREES:
-      for (lv_coord_t x = height; x-- != 0;) {
-        for (lv_coord_t y = 0; y != width; y++) {
-          dst[y * height + x] = *ptr++;
+      // transpose in tiles, writing down whole columns of the destination thrashes the cache
+      for (lv_coord_t y0 = 0; y0 < height; y0 += ROTATE_TILE) {
+        for (lv_coord_t x0 = 0; x0 < width; x0 += ROTATE_TILE) {
+          for (lv_coord_t y = y0; y != std::min<lv_coord_t>(y0 + ROTATE_TILE, height); y++) {
+            const lv_color_t *src = ptr + y * width;
+            for (lv_coord_t x = x0; x != std::min<lv_coord_t>(x0 + ROTATE_TILE, width); x++)
+              dst[x * height + height - 1 - y] = src[x];
+          }
         }
       }
       y1 = x1;
@@ -176,9 +184,13 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
       break;
 
     case display::DISPLAY_ROTATION_270_DEGREES:
-      for (lv_coord_t x = 0; x != height; x++) {
-        for (lv_coord_t y = width; y-- != 0;) {
-          dst[y * height + x] = *ptr++;
+      for (lv_coord_t y0 = 0; y0 < height; y0 += ROTATE_TILE) {
+        for (lv_coord_t x0 = 0; x0 < width; x0 += ROTATE_TILE) {
+          for (lv_coord_t y = y0; y != std::min<lv_coord_t>(y0 + ROTATE_TILE, height); y++) {
+            const lv_color_t *src = ptr + y * width;
+            for (lv_coord_t x = x0; x != std::min<lv_coord_t>(x0 + ROTATE_TILE, width); x++)
+              dst[(width - 1 - x) * height + y] = src[x];
+          }
         }
       }
       x1 = y1;
@@ -200,10 +212,15 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
 
 void LvglComponent::flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   if (!this->paused_) {
-    auto now = millis();
+    auto now = micros();
     this->draw_buffer_(area, color_p);
+    auto took = micros() - now;
     ESP_LOGVV(TAG, "flush_cb, area=%d/%d, %d/%d took %dms", area->x1, area->y1, lv_area_get_width(area),
-              lv_area_get_height(area), (int) (millis() - now));
+              lv_area_get_height(area), (int) (took / 1000));
+    this->flush_count_++;
+    this->flush_time_us_ += took;
+    if (lv_disp_flush_is_last(disp_drv))
+      this->frame_count_++;
   }
   lv_disp_flush_ready(disp_drv);
 }
@@ -462,6 +479,7 @@ void LvglComponent::setup() {
     display->set_rotation(display::DISPLAY_ROTATION_0_DEGREES);
   this->show_page(0, LV_SCR_LOAD_ANIM_NONE, 0);
   lv_disp_trig_activity(this->disp_);
+  this->stats_start_ = millis();
   ESP_LOGCONFIG(TAG, "LVGL Setup complete");
 }
 
@@ -471,6 +489,17 @@ void LvglComponent::update() {
     return;
   }
   this->idle_callbacks_.call(lv_disp_get_inactive_time(this->disp_));
+
+  auto now = millis();
+  if (this->flush_count_ != 0) {
+    ESP_LOGV(TAG, "%.1f fps, %" PRIu32 " flushes took %" PRIu32 "ms in total",
+             this->frame_count_ * 1000.0f / (now - this->stats_start_), this->flush_count_,
+             this->flush_time_us_ / 1000);
+  }
+  this->stats_start_ = now;
+  this->frame_count_ = 0;
+  this->flush_count_ = 0;
+  this->flush_time_us_ = 0;
 }
 void LvglComponent::loop() {
   if (this->paused_) {
@@ -229,6 +229,12 @@ class LvglComponent : public PollingComponent {
   CallbackManager<void(uint32_t)> idle_callbacks_{};
   CallbackManager<void(bool)> pause_callbacks_{};
   lv_color_t *rotate_buf_{};
+
+  // flush statistics since the last update()
+  uint32_t stats_start_{};
+  uint32_t frame_count_{};
+  uint32_t flush_count_{};
+  uint32_t flush_time_us_{};
 };
 
 class IdleTrigger : public Trigger<> {
@@ -221,6 +221,15 @@ class MQTTClientComponent : public Component {
   bool publish(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos = 0,
                bool retain = false);
 
+  /** Publish a MQTT message without copying the topic or payload
+   *
+   * @param topic The topic, null terminated.
+   * @param payload The payload, does not need to be null terminated.
+   * @param payload_length The length of the payload.
+   * @param retain Whether to retain the message.
+   */
+  bool publish(const char *topic, const char *payload, size_t payload_length, uint8_t qos = 0, bool retain = false);
+
   /** Construct and send a JSON MQTT message.
    *
    * @param topic The topic.
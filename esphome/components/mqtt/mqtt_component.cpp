@@ -36,22 +36,42 @@ std::string MQTTComponent::get_default_topic_for_(const std::string &suffix) con
   return topic_prefix + "/" + this->component_type() + "/" + this->get_default_object_id_() + "/" + suffix;
 }
 
-std::string MQTTComponent::get_state_topic_() const {
-  if (this->has_custom_state_topic_)
-    return this->custom_state_topic_.str();
-  return this->get_default_topic_for_("state");
+const std::string &MQTTComponent::get_state_topic_() const {
+  if (!this->state_topic_built_) {
+    if (this->has_custom_state_topic_) {
+      this->state_topic_ = this->custom_state_topic_.str();
+    } else {
+      this->state_topic_ = this->get_default_topic_for_("state");
+    }
+    this->state_topic_built_ = true;
+  }
+  return this->state_topic_;
 }
 
-std::string MQTTComponent::get_command_topic_() const {
-  if (this->has_custom_command_topic_)
-    return this->custom_command_topic_.str();
-  return this->get_default_topic_for_("command");
+const std::string &MQTTComponent::get_command_topic_() const {
+  if (!this->command_topic_built_) {
+    if (this->has_custom_command_topic_) {
+      this->command_topic_ = this->custom_command_topic_.str();
+    } else {
+      this->command_topic_ = this->get_default_topic_for_("command");
+    }
+    this->command_topic_built_ = true;
+  }
+  return this->command_topic_;
 }
 
 bool MQTTComponent::publish(const std::string &topic, const std::string &payload) {
+  return this->publish(topic, payload.data(), payload.size());
+}
+
+bool MQTTComponent::publish(const std::string &topic, const char *payload) {
+  return this->publish(topic, payload, strlen(payload));
+}
+
+bool MQTTComponent::publish(const std::string &topic, const char *payload, size_t payload_length) {
   if (topic.empty())
     return false;
-  return global_mqtt_client->publish(topic, payload, this->qos_, this->retain_);
+  return global_mqtt_client->publish(topic.c_str(), payload, payload_length, this->qos_, this->retain_);
 }
 
 bool MQTTComponent::publish_json(const std::string &topic, const json::json_build_t &f) {
@@ -221,10 +241,12 @@ void MQTTComponent::disable_discovery() { this->discovery_enabled_ = false; }
 void MQTTComponent::set_custom_state_topic(const char *custom_state_topic) {
   this->custom_state_topic_ = StringRef(custom_state_topic);
   this->has_custom_state_topic_ = true;
+  this->state_topic_built_ = false;
 }
 void MQTTComponent::set_custom_command_topic(const char *custom_command_topic) {
   this->custom_command_topic_ = StringRef(custom_command_topic);
   this->has_custom_command_topic_ = true;
+  this->command_topic_built_ = false;
 }
 void MQTTComponent::set_command_retain(bool command_retain) { this->command_retain_ = command_retain; }
 
@@ -122,6 +122,21 @@ class MQTTComponent : public Component {
    */
   bool publish(const std::string &topic, const std::string &payload);
 
+  /** Send a MQTT message without copying the payload.
+   *
+   * @param topic The topic.
+   * @param payload The payload, null terminated.
+   */
+  bool publish(const std::string &topic, const char *payload);
+
+  /** Send a MQTT message without copying the payload.
+   *
+   * @param topic The topic.
+   * @param payload The payload.
+   * @param payload_length The length of the payload.
+   */
+  bool publish(const std::string &topic, const char *payload, size_t payload_length);
+
   /** Construct and send a JSON MQTT message.
    *
    * @param topic The topic.
@@ -180,11 +195,11 @@ class MQTTComponent : public Component {
   /// Get whether the underlying Entity is disabled by default
   virtual bool is_disabled_by_default() const;
 
-  /// Get the MQTT topic that new states will be shared to.
-  std::string get_state_topic_() const;
+  /// Get the MQTT topic that new states will be shared to, built on first use.
+  const std::string &get_state_topic_() const;
 
-  /// Get the MQTT topic for listening to commands.
-  std::string get_command_topic_() const;
+  /// Get the MQTT topic for listening to commands, built on first use.
+  const std::string &get_command_topic_() const;
 
   bool is_connected_() const;
 
@@ -204,6 +219,12 @@ class MQTTComponent : public Component {
   bool has_custom_state_topic_{false};
   bool has_custom_command_topic_{false};
 
+  // State and command topics, so publishing a state does not build the topic again
+  mutable std::string state_topic_{};
+  mutable std::string command_topic_{};
+  mutable bool state_topic_built_{false};
+  mutable bool command_topic_built_{false};
+
   bool command_retain_{false};
   bool retain_{true};
   uint8_t qos_{0};
@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.const import CONF_ID
+from esphome.const import CONF_ID, PLATFORM_ESP32, PLATFORM_HOST
 
 CODEOWNERS = ["@esphome/core"]
 
@@ -8,10 +8,14 @@ preferences_ns = cg.esphome_ns.namespace("preferences")
 IntervalSyncer = preferences_ns.class_("IntervalSyncer", cg.Component)
 
 CONF_FLASH_WRITE_INTERVAL = "flash_write_interval"
+CONF_MAX_SYNCS_PER_HOUR = "max_syncs_per_hour"
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(IntervalSyncer),
         cv.Optional(CONF_FLASH_WRITE_INTERVAL, default="60s"): cv.update_interval,
+        cv.Optional(CONF_MAX_SYNCS_PER_HOUR): cv.All(
+            cv.only_on([PLATFORM_ESP32, PLATFORM_HOST]), cv.positive_not_null_int
+        ),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -19,4 +23,6 @@ CONFIG_SCHEMA = cv.Schema(
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     cg.add(var.set_write_interval(config[CONF_FLASH_WRITE_INTERVAL]))
+    if CONF_MAX_SYNCS_PER_HOUR in config:
+        cg.add(var.set_max_syncs_per_hour(config[CONF_MAX_SYNCS_PER_HOUR]))
     await cg.register_component(var, config)
@@ -2,6 +2,7 @@
 
 #include "esphome/core/preferences.h"
 #include "esphome/core/component.h"
+#include "esphome/core/hal.h"
 
 namespace esphome {
 namespace preferences {
@@ -9,21 +10,49 @@ namespace preferences {
 class IntervalSyncer : public Component {
  public:
   void set_write_interval(uint32_t write_interval) { this->write_interval_ = write_interval; }
+  /// Limit how many syncs that write to flash may start per hour. This is not a limit on writes: a sync writes all
+  /// preferences that are pending when it starts.
+  void set_max_syncs_per_hour(uint32_t max_syncs_per_hour) { this->max_syncs_per_hour_ = max_syncs_per_hour; }
   void setup() override {
     if (this->write_interval_ != 0) {
-      set_interval(this->write_interval_, []() { global_preferences->sync(); });
+      set_interval(this->write_interval_, [this]() { this->sync_(); });
+      // syncing is driven by the interval only
+      this->disable_loop();
     }
   }
   void loop() override {
     if (this->write_interval_ == 0) {
-      global_preferences->sync();
+      this->sync_();
     }
   }
   void on_shutdown() override { global_preferences->sync(); }
   float get_setup_priority() const override { return setup_priority::BUS; }
 
  protected:
+  void sync_() {
+    if (this->max_syncs_per_hour_ == 0) {
+      global_preferences->sync();
+      return;
+    }
+    const uint32_t now = millis();
+    if (now - this->budget_start_ >= 60 * 60 * 1000) {
+      this->budget_start_ = now;
+      this->budget_syncs_ = 0;
+    }
+    // saves stay pending until the next hour, and are always written on shutdown
+    if (this->budget_syncs_ >= this->max_syncs_per_hour_)
+      return;
+    const uint32_t writes = global_preferences->get_sync_stats().writes;
+    global_preferences->sync();
+    // syncs with nothing to write are free
+    if (global_preferences->get_sync_stats().writes != writes)
+      this->budget_syncs_++;
+  }
+
   uint32_t write_interval_{60000};
+  uint32_t max_syncs_per_hour_{0};
+  uint32_t budget_start_{0};
+  uint32_t budget_syncs_{0};
 };
 
 }  // namespace preferences
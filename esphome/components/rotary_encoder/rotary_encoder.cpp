@@ -126,6 +126,7 @@ void IRAM_ATTR HOT RotaryEncoderSensorStore::gpio_intr(RotaryEncoderSensorStore
   arg->first_read = false;
 
   arg->state = new_state;
+  arg->parent->enable_loop_soon_any_context();
 }
 
 void RotaryEncoderSensor::setup() {
@@ -147,6 +148,7 @@ void RotaryEncoderSensor::setup() {
 
   this->store_.counter = initial_value;
   this->store_.last_read = initial_value;
+  this->store_.parent = this;
 
   this->pin_a_->setup();
   this->store_.pin_a = this->pin_a_->to_isr();
@@ -235,6 +237,10 @@ void RotaryEncoderSensor::loop() {
     this->listeners_.call(counter);
     this->publish_initial_value_ = false;
   }
+
+  // Without an index pin all state changes arrive through the interrupt, which wakes us up again
+  if (this->pin_i_ == nullptr)
+    this->disable_loop();
 }
 
 float RotaryEncoderSensor::get_setup_priority() const { return setup_priority::DATA; }
@@ -1,6 +1,7 @@
 #ifdef USE_HOST
 #include "sdl_esphome.h"
 #include "esphome/components/display/display_color_utils.h"
+#include <algorithm>
 
 namespace esphome {
 namespace sdl {
@@ -61,6 +62,37 @@ void Sdl::draw_pixel_at(int x, int y, Color color) {
     this->y_high_ = y;
 }
 
+void Sdl::blit_span_565(int x, int y, int w, const uint8_t *data) {
+  if (y < 0 || y >= this->height_)
+    return;
+  if (x < 0) {
+    data -= x * 2;
+    w += x;
+    x = 0;
+  }
+  w = std::min(w, this->width_ - x);
+  if (w <= 0)
+    return;
+  // the texture holds native-endian RGB565, swap the run in chunks
+  uint16_t buf[64];
+  for (int i = 0; i < w;) {
+    int len = std::min(w - i, 64);
+    for (int j = 0; j != len; j++, data += 2)
+      buf[j] = encode_uint16(data[0], data[1]);
+    SDL_Rect rect{x + i, y, len, 1};
+    SDL_UpdateTexture(this->texture_, &rect, buf, len * 2);
+    i += len;
+  }
+  if (x < this->x_low_)
+    this->x_low_ = x;
+  if (y < this->y_low_)
+    this->y_low_ = y;
+  if (x + w - 1 > this->x_high_)
+    this->x_high_ = x + w - 1;
+  if (y > this->y_high_)
+    this->y_high_ = y;
+}
+
 void Sdl::process_key(uint32_t keycode, bool down) {
   auto callback = this->key_callbacks_.find(keycode);
   if (callback != this->key_callbacks_.end())
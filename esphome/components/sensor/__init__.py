@@ -34,6 +34,7 @@ from esphome.const import (
     CONF_TO,
     CONF_TRIGGER_ID,
     CONF_TYPE,
+    CONF_TYPE_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_VALUE,
     CONF_WEB_SERVER,
@@ -92,9 +93,9 @@ from esphome.const import (
     DEVICE_CLASS_WIND_SPEED,
     ENTITY_CATEGORY_CONFIG,
 )
-from esphome.core import CORE, coroutine_with_priority
+from esphome.core import CORE, ID, coroutine_with_priority
 from esphome.cpp_generator import MockObjClass
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import extract_registry_entry_config, setup_entity
 from esphome.util import Registry
 
 CODEOWNERS = ["@esphome/core"]
@@ -251,6 +252,16 @@ SensorInRangeCondition = sensor_ns.class_("SensorInRangeCondition", Filter)
 ClampFilter = sensor_ns.class_("ClampFilter", Filter)
 RoundFilter = sensor_ns.class_("RoundFilter", Filter)
 RoundMultipleFilter = sensor_ns.class_("RoundMultipleFilter", Filter)
+FusedFilter = sensor_ns.class_("FusedFilter", Filter)
+
+# Stateless steps that consecutive filters are fused into
+OffsetStep = sensor_ns.class_("OffsetStep")
+MultiplyStep = sensor_ns.class_("MultiplyStep")
+CalibrateLinearStep = sensor_ns.class_("CalibrateLinearStep")
+CalibratePolynomialStep = sensor_ns.class_("CalibratePolynomialStep")
+ClampStep = sensor_ns.class_("ClampStep")
+RoundStep = sensor_ns.class_("RoundStep")
+RoundMultipleStep = sensor_ns.class_("RoundMultipleStep")
 
 validate_unit_of_measurement = cv.string_strict
 validate_accuracy_decimals = cv.int_
@@ -647,6 +658,10 @@ def validate_calibrate_linear(config):
     ),
 )
 async def calibrate_linear_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, calibrate_linear_functions(config))
+
+
+def calibrate_linear_functions(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
 
@@ -656,7 +671,7 @@ async def calibrate_linear_filter_to_code(config, filter_id):
         linear_functions = [[k, b, float("NaN")]]
     elif config[CONF_METHOD] == "exact":
         linear_functions = map_linear(x, y)
-    return cg.new_Pvariable(filter_id, linear_functions)
+    return linear_functions
 
 
 CONF_DEGREE = "degree"
@@ -687,14 +702,17 @@ def validate_calibrate_polynomial(config):
     ),
 )
 async def calibrate_polynomial_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, calibrate_polynomial_coefficients(config))
+
+
+def calibrate_polynomial_coefficients(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
     degree = config[CONF_DEGREE]
     a = [[1] + [x_ ** (i + 1) for i in range(degree)] for x_ in x]
     # Column vector
     b = [[v] for v in y]
-    res = [v[0] for v in _lstsq(a, b)]
-    return cg.new_Pvariable(filter_id, res)
+    return [v[0] for v in _lstsq(a, b)]
 
 
 def validate_clamp(config):
@@ -763,10 +781,77 @@ async def round_multiple_filter_to_code(config, filter_id):
     )
 
 
+def _constant_step_args(config):
+    # Templated values are evaluated for every value, those filters are not fused
+    if cg.is_template(config):
+        return None
+    return [config]
+
+
+# Filters without state, mapped to the step they can be fused into and the arguments of that step
+FUSABLE_FILTERS = {
+    "offset": (OffsetStep, _constant_step_args),
+    "multiply": (MultiplyStep, _constant_step_args),
+    "calibrate_linear": (
+        CalibrateLinearStep,
+        lambda config: [calibrate_linear_functions(config)],
+    ),
+    "calibrate_polynomial": (
+        CalibratePolynomialStep,
+        lambda config: [calibrate_polynomial_coefficients(config)],
+    ),
+    "clamp": (
+        ClampStep,
+        lambda config: [
+            config[CONF_MIN_VALUE],
+            config[CONF_MAX_VALUE],
+            config[CONF_IGNORE_OUT_OF_RANGE],
+        ],
+    ),
+    "round": (RoundStep, lambda config: [config[CONF_ACCURACY_DECIMALS]]),
+    "round_to_multiple_of": (RoundMultipleStep, lambda config: [config[CONF_MULTIPLE]]),
+}
+
+
+async def _build_fused_filter(run):
+    if len(run) == 1:
+        return await cg.build_registry_entry(FILTER_REGISTRY, run[0][0])
+    first_id = run[0][0][CONF_TYPE_ID]
+    fused_id = ID(f"{first_id.id}_fused", is_declaration=True, type=FusedFilter)
+    step_types = [step_type for _, step_type, _ in run]
+    steps = [step_type(*args) for _, step_type, args in run]
+    return cg.new_Pvariable(fused_id, cg.TemplateArguments(*step_types), *steps)
+
+
 async def build_filters(config):
     return await cg.build_registry_list(FILTER_REGISTRY, config)
 
 
+async def build_fused_filters(config):
+    """Build the filter chain of a sensor, runs of stateless filters are fused into a single FusedFilter.
+
+    Only for the sensor's own chain: the filters of `or:` are parallel branches and must stay separate.
+    """
+    filters = []
+    run = []
+    for conf in config:
+        registry_entry, entry_config = extract_registry_entry_config(
+            FILTER_REGISTRY, conf
+        )
+        step_type, step_args = FUSABLE_FILTERS.get(registry_entry.name, (None, None))
+        args = step_args(entry_config) if step_args is not None else None
+        if args is not None:
+            run.append((conf, step_type, args))
+            continue
+        if run:
+            filters.append(await _build_fused_filter(run))
+            run = []
+        filters.append(await cg.build_registry_entry(FILTER_REGISTRY, conf))
+    if run:
+        filters.append(await _build_fused_filter(run))
+    return filters
+
+
 async def setup_sensor_core_(var, config):
     await setup_entity(var, config)
 
@@ -780,7 +865,7 @@ async def setup_sensor_core_(var, config):
         cg.add(var.set_accuracy_decimals(accuracy_decimals))
     cg.add(var.set_force_update(config[CONF_FORCE_UPDATE]))
     if config.get(CONF_FILTERS):  # must exist and not be empty
-        filters = await build_filters(config[CONF_FILTERS])
+        filters = await build_fused_filters(config[CONF_FILTERS])
         cg.add(var.set_filters(filters))
 
     for conf in config.get(CONF_ON_VALUE, []):
@@ -1,4 +1,5 @@
 #include "filter.h"
+#include <algorithm>
 #include <cmath>
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -31,40 +32,72 @@ void Filter::initialize(Sensor *parent, Filter *next) {
   this->next_ = next;
 }
 
+// SortedWindow
+void SortedWindow::set_window_size(size_t window_size) {
+  this->values_.set_capacity(window_size);
+  this->sorted_.clear();
+  this->sorted_.reserve(window_size);
+  for (size_t i = 0; i < this->values_.size(); i++) {
+    if (!std::isnan(this->values_[i]))
+      this->insert_sorted_(this->values_[i]);
+  }
+}
+void SortedWindow::push(float value) {
+  if (this->values_.capacity() == 0)
+    return;
+  const bool evict = this->values_.full();
+  const float evicted = evict ? this->values_.front() : NAN;
+  if (evict)
+    this->values_.pop_front();
+  this->values_.push_back(value);
+
+  if (evict && !std::isnan(evicted) && !std::isnan(value)) {
+    // Replace the evicted value in place, only shifting the values between the two slots
+    auto begin = this->sorted_.begin();
+    auto removed = std::lower_bound(begin, this->sorted_.end(), evicted);
+    auto inserted = std::upper_bound(begin, this->sorted_.end(), value);
+    if (inserted > removed) {
+      std::move(removed + 1, inserted, removed);
+      *(inserted - 1) = value;
+    } else {
+      std::move_backward(inserted, removed, removed + 1);
+      *inserted = value;
+    }
+    return;
+  }
+  if (evict && !std::isnan(evicted))
+    this->erase_sorted_(evicted);
+  if (!std::isnan(value))
+    this->insert_sorted_(value);
+}
+void SortedWindow::insert_sorted_(float value) {
+  this->sorted_.insert(std::upper_bound(this->sorted_.begin(), this->sorted_.end(), value), value);
+}
+void SortedWindow::erase_sorted_(float value) {
+  this->sorted_.erase(std::lower_bound(this->sorted_.begin(), this->sorted_.end(), value));
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->window_.set_window_size(window_size);
+}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MedianFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MedianFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float median = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> median_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          median_queue.push_back(v);
-        }
-      }
-
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size) {
-        if (queue_size % 2) {
-          median = median_queue[queue_size / 2];
-        } else {
-          median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-        }
+    size_t queue_size = this->window_.size();
+    if (queue_size) {
+      if (queue_size % 2) {
+        median = this->window_[queue_size / 2];
+      } else {
+        median = (this->window_[queue_size / 2] + this->window_[(queue_size / 2) - 1]) / 2.0f;
       }
     }
 
@@ -89,38 +122,25 @@ optional<float> SkipInitialFilter::new_value(float value) {
 
 // QuantileFilter
 QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size), quantile_(quantile) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at), quantile_(quantile) {
+  this->window_.set_window_size(window_size);
+}
 void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void QuantileFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void QuantileFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
 optional<float> QuantileFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f), quantile:%f", this, value, this->quantile_);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float result = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> quantile_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          quantile_queue.push_back(v);
-        }
-      }
-
-      sort(quantile_queue.begin(), quantile_queue.end());
-
-      size_t queue_size = quantile_queue.size();
-      if (queue_size) {
-        size_t position = ceilf(queue_size * this->quantile_) - 1;
-        ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, queue_size);
-        result = quantile_queue[position];
-      }
+    size_t queue_size = this->window_.size();
+    if (queue_size) {
+      size_t position = ceilf(queue_size * this->quantile_) - 1;
+      ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, queue_size);
+      result = this->window_[position];
     }
 
     ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING %f", this, value, result);
@@ -131,26 +151,19 @@ optional<float> QuantileFilter::new_value(float value) {
 
 // MinFilter
 MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->window_.set_window_size(window_size);
+}
 void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MinFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MinFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float min = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        min = std::isnan(min) ? v : std::min(min, v);
-      }
-    }
-
+    float min = this->window_.get();
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING %f", this, value, min);
     return min;
   }
@@ -159,26 +172,19 @@ optional<float> MinFilter::new_value(float value) {
 
 // MaxFilter
 MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->window_.set_window_size(window_size);
+}
 void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MaxFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MaxFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float max = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        max = std::isnan(max) ? v : std::max(max, v);
-      }
-    }
-
+    float max = this->window_.get();
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING %f", this, value, max);
     return max;
   }
@@ -188,31 +194,50 @@ optional<float> MaxFilter::new_value(float value) {
 // SlidingWindowMovingAverageFilter
 SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every,
                                                                    size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->queue_.set_capacity(window_size);
+}
 void SlidingWindowMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) {
+  this->queue_.set_capacity(window_size);
+  this->recalculate_sum_();
+}
+void SlidingWindowMovingAverageFilter::recalculate_sum_() {
+  this->sum_ = 0;
+  this->valid_count_ = 0;
+  for (size_t i = 0; i < this->queue_.size(); i++) {
+    if (!std::isnan(this->queue_[i])) {
+      this->sum_ += this->queue_[i];
+      this->valid_count_++;
+    }
+  }
+}
 optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
+  if (this->queue_.capacity() == 0)
+    return {};
+  if (this->queue_.full()) {
+    float evicted = this->queue_.front();
     this->queue_.pop_front();
+    if (std::isinf(evicted)) {
+      this->recalculate_sum_();
+    } else if (!std::isnan(evicted)) {
+      this->sum_ -= evicted;
+      this->valid_count_--;
+    }
   }
   this->queue_.push_back(value);
+  if (!std::isnan(value)) {
+    this->sum_ += value;
+    this->valid_count_++;
+  }
   ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float sum = 0;
-    size_t valid_count = 0;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        sum += v;
-        valid_count++;
-      }
-    }
-
     float average = NAN;
-    if (valid_count) {
-      average = sum / valid_count;
+    if (this->valid_count_) {
+      average = this->sum_ / this->valid_count_;
     }
 
     ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f) SENDING %f", this, value, average);
@@ -424,60 +449,31 @@ void HeartbeatFilter::setup() {
 float HeartbeatFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 optional<float> CalibrateLinearFilter::new_value(float value) {
-  for (std::array<float, 3> f : this->linear_functions_) {
-    if (!std::isfinite(f[2]) || value < f[2])
-      return (value * f[0]) + f[1];
-  }
-  return NAN;
+  this->step_.apply(value);
+  return value;
 }
 
 optional<float> CalibratePolynomialFilter::new_value(float value) {
-  float res = 0.0f;
-  float x = 1.0f;
-  for (float coefficient : this->coefficients_) {
-    res += x * coefficient;
-    x *= value;
-  }
-  return res;
+  this->step_.apply(value);
+  return value;
 }
 
-ClampFilter::ClampFilter(float min, float max, bool ignore_out_of_range)
-    : min_(min), max_(max), ignore_out_of_range_(ignore_out_of_range) {}
+ClampFilter::ClampFilter(float min, float max, bool ignore_out_of_range) : step_(min, max, ignore_out_of_range) {}
 optional<float> ClampFilter::new_value(float value) {
-  if (std::isfinite(value)) {
-    if (std::isfinite(this->min_) && value < this->min_) {
-      if (this->ignore_out_of_range_) {
-        return {};
-      } else {
-        return this->min_;
-      }
-    }
-
-    if (std::isfinite(this->max_) && value > this->max_) {
-      if (this->ignore_out_of_range_) {
-        return {};
-      } else {
-        return this->max_;
-      }
-    }
-  }
+  if (!this->step_.apply(value))
+    return {};
   return value;
 }
 
-RoundFilter::RoundFilter(uint8_t precision) : precision_(precision) {}
+RoundFilter::RoundFilter(uint8_t precision) : step_(precision) {}
 optional<float> RoundFilter::new_value(float value) {
-  if (std::isfinite(value)) {
-    float accuracy_mult = powf(10.0f, this->precision_);
-    return roundf(accuracy_mult * value) / accuracy_mult;
-  }
+  this->step_.apply(value);
   return value;
 }
 
-RoundMultipleFilter::RoundMultipleFilter(float multiple) : multiple_(multiple) {}
+RoundMultipleFilter::RoundMultipleFilter(float multiple) : step_(multiple) {}
 optional<float> RoundMultipleFilter::new_value(float value) {
-  if (std::isfinite(value)) {
-    return value - remainderf(value, this->multiple_);
-  }
+  this->step_.apply(value);
   return value;
 }
 
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
 #include <queue>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include "esphome/core/component.h"
@@ -44,6 +50,128 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/** Fixed-capacity ring of the most recent values.
+ *
+ * Storage is allocated when the capacity is set, pushing and popping values never allocates.
+ */
+template<typename T> class FixedRing {
+ public:
+  /// Change the capacity, keeping the most recent values that still fit.
+  void set_capacity(size_t capacity) {
+    if (capacity == this->buffer_.size())
+      return;
+    std::vector<T> buffer(capacity);
+    size_t keep = std::min(this->size_, capacity);
+    for (size_t i = 0; i < keep; i++)
+      buffer[i] = (*this)[this->size_ - keep + i];
+    this->buffer_ = std::move(buffer);
+    this->head_ = 0;
+    this->size_ = keep;
+  }
+  size_t capacity() const { return this->buffer_.size(); }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  bool full() const { return this->size_ == this->buffer_.size(); }
+
+  /// The i-th oldest value.
+  const T &operator[](size_t i) const { return this->buffer_[this->index_(i)]; }
+  const T &front() const { return this->buffer_[this->head_]; }
+  const T &back() const { return (*this)[this->size_ - 1]; }
+  /// Append a value, the ring must not be full.
+  void push_back(const T &value) {
+    this->buffer_[this->index_(this->size_)] = value;
+    this->size_++;
+  }
+  void pop_front() {
+    this->head_ = this->index_(1);
+    this->size_--;
+  }
+  void pop_back() { this->size_--; }
+  void clear() {
+    this->head_ = 0;
+    this->size_ = 0;
+  }
+
+ protected:
+  size_t index_(size_t i) const {
+    i += this->head_;
+    return i >= this->buffer_.size() ? i - this->buffer_.size() : i;
+  }
+
+  std::vector<T> buffer_;
+  size_t head_{0};
+  size_t size_{0};
+};
+
+/** Sliding window minimum or maximum with amortized O(1) updates.
+ *
+ * Only values that can still become the extreme are kept: a new value evicts every older one that is not more
+ * extreme than it, so the candidates stay ordered and the extreme of the window is always the oldest candidate.
+ */
+template<typename Compare> class MonotonicWindow {
+ public:
+  /// Change the window size, the current extreme is kept if it is still within the new window.
+  void set_window_size(size_t window_size) {
+    this->window_size_ = window_size;
+    this->expire_();
+    this->candidates_.set_capacity(window_size);
+  }
+  /// Add a value, NaN values take up a slot in the window but are never the extreme.
+  void push(float value) {
+    if (this->window_size_ == 0)
+      return;
+    this->count_++;
+    this->expire_();
+    if (std::isnan(value))
+      return;
+    while (!this->candidates_.empty() && !Compare()(this->candidates_.back().value, value))
+      this->candidates_.pop_back();
+    this->candidates_.push_back(Candidate{this->count_, value});
+  }
+  /// The extreme of the non-NaN values in the window, NaN if there are none.
+  float get() const { return this->candidates_.empty() ? NAN : this->candidates_.front().value; }
+
+ protected:
+  struct Candidate {
+    uint32_t index;
+    float value;
+  };
+  void expire_() {
+    while (!this->candidates_.empty() && this->count_ - this->candidates_.front().index >= this->window_size_)
+      this->candidates_.pop_front();
+  }
+
+  FixedRing<Candidate> candidates_;
+  size_t window_size_{0};
+  uint32_t count_{0};
+};
+
+/** Sliding window that keeps its non-NaN values sorted, for order statistics like the median.
+ *
+ * Adding a value finds the slots of the evicted and the new value with binary searches and only moves the values
+ * between them, so no copy or sort of the whole window is needed to read a quantile.
+ */
+class SortedWindow {
+ public:
+  /// Change the window size, keeping the most recent values that still fit.
+  void set_window_size(size_t window_size);
+  /// Add a value, evicting the oldest one if the window is full.
+  void push(float value);
+
+  /// Number of non-NaN values in the window.
+  size_t size() const { return this->sorted_.size(); }
+  bool empty() const { return this->sorted_.empty(); }
+  /// The i-th smallest non-NaN value in the window.
+  float operator[](size_t i) const { return this->sorted_[i]; }
+
+ protected:
+  void insert_sorted_(float value);
+  void erase_sorted_(float value);
+
+  FixedRing<float> values_;
+  std::vector<float> sorted_;
+};
+
 /** Simple quantile filter.
  *
  * Takes the quantile of the last <send_every> values and pushes it out every <send_every>.
@@ -68,10 +196,9 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
   float quantile_;
 };
 
@@ -97,10 +224,9 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple skip filter.
@@ -143,10 +269,9 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow<std::less<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple max filter.
@@ -171,10 +296,9 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow<std::greater<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
@@ -200,10 +324,15 @@ class SlidingWindowMovingAverageFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  /// Recompute the running sum from the window, needed once an infinite value left it.
+  void recalculate_sum_();
+
+  FixedRing<float> queue_;
+  /// Sum and count of the non-NaN values in the window
+  double sum_{0};
+  size_t valid_count_{0};
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple exponential moving average filter.
@@ -391,23 +520,138 @@ class OrFilter : public Filter {
   PhiNode phi_;
 };
 
-class CalibrateLinearFilter : public Filter {
+/** Stateless filter steps, shared by the filters below and chained without virtual calls by FusedFilter.
+ *
+ * apply() changes the value in place and returns false if the value should not be passed on.
+ */
+class OffsetStep {
+ public:
+  explicit OffsetStep(float offset) : offset_(offset) {}
+  bool apply(float &value) const {
+    value += this->offset_;
+    return true;
+  }
+
+ protected:
+  float offset_;
+};
+
+class MultiplyStep {
+ public:
+  explicit MultiplyStep(float multiplier) : multiplier_(multiplier) {}
+  bool apply(float &value) const {
+    value *= this->multiplier_;
+    return true;
+  }
+
+ protected:
+  float multiplier_;
+};
+
+class CalibrateLinearStep {
  public:
-  CalibrateLinearFilter(std::vector<std::array<float, 3>> linear_functions)
+  explicit CalibrateLinearStep(std::vector<std::array<float, 3>> linear_functions)
       : linear_functions_(std::move(linear_functions)) {}
-  optional<float> new_value(float value) override;
+  bool apply(float &value) const {
+    for (const std::array<float, 3> &f : this->linear_functions_) {
+      if (!std::isfinite(f[2]) || value < f[2]) {
+        value = (value * f[0]) + f[1];
+        return true;
+      }
+    }
+    value = NAN;
+    return true;
+  }
 
  protected:
   std::vector<std::array<float, 3>> linear_functions_;
 };
 
+class CalibratePolynomialStep {
+ public:
+  explicit CalibratePolynomialStep(std::vector<float> coefficients) : coefficients_(std::move(coefficients)) {}
+  bool apply(float &value) const {
+    float res = 0.0f;
+    float x = 1.0f;
+    for (float coefficient : this->coefficients_) {
+      res += x * coefficient;
+      x *= value;
+    }
+    value = res;
+    return true;
+  }
+
+ protected:
+  std::vector<float> coefficients_;
+};
+
+class ClampStep {
+ public:
+  ClampStep(float min, float max, bool ignore_out_of_range)
+      : min_(min), max_(max), ignore_out_of_range_(ignore_out_of_range) {}
+  bool apply(float &value) const {
+    if (std::isfinite(value)) {
+      if (std::isfinite(this->min_) && value < this->min_) {
+        if (this->ignore_out_of_range_)
+          return false;
+        value = this->min_;
+      } else if (std::isfinite(this->max_) && value > this->max_) {
+        if (this->ignore_out_of_range_)
+          return false;
+        value = this->max_;
+      }
+    }
+    return true;
+  }
+
+ protected:
+  float min_;
+  float max_;
+  bool ignore_out_of_range_;
+};
+
+class RoundStep {
+ public:
+  explicit RoundStep(uint8_t precision) : accuracy_mult_(powf(10.0f, precision)) {}
+  bool apply(float &value) const {
+    if (std::isfinite(value))
+      value = roundf(this->accuracy_mult_ * value) / this->accuracy_mult_;
+    return true;
+  }
+
+ protected:
+  float accuracy_mult_;
+};
+
+class RoundMultipleStep {
+ public:
+  explicit RoundMultipleStep(float multiple) : multiple_(multiple) {}
+  bool apply(float &value) const {
+    if (std::isfinite(value))
+      value -= remainderf(value, this->multiple_);
+    return true;
+  }
+
+ protected:
+  float multiple_;
+};
+
+class CalibrateLinearFilter : public Filter {
+ public:
+  CalibrateLinearFilter(std::vector<std::array<float, 3>> linear_functions) : step_(std::move(linear_functions)) {}
+  optional<float> new_value(float value) override;
+
+ protected:
+  CalibrateLinearStep step_;
+};
+
 class CalibratePolynomialFilter : public Filter {
  public:
-  CalibratePolynomialFilter(std::vector<float> coefficients) : coefficients_(std::move(coefficients)) {}
+  CalibratePolynomialFilter(std::vector<float> coefficients) : step_(std::move(coefficients)) {}
   optional<float> new_value(float value) override;
 
  protected:
-  std::vector<float> coefficients_;
+  CalibratePolynomialStep step_;
 };
 
 class ClampFilter : public Filter {
@@ -416,9 +660,7 @@ class ClampFilter : public Filter {
   optional<float> new_value(float value) override;
 
  protected:
-  float min_{NAN};
-  float max_{NAN};
-  bool ignore_out_of_range_;
+  ClampStep step_;
 };
 
 class RoundFilter : public Filter {
@@ -427,7 +669,7 @@ class RoundFilter : public Filter {
   optional<float> new_value(float value) override;
 
  protected:
-  uint8_t precision_;
+  RoundStep step_;
 };
 
 class RoundMultipleFilter : public Filter {
@@ -436,7 +678,31 @@ class RoundMultipleFilter : public Filter {
   optional<float> new_value(float value) override;
 
  protected:
-  float multiple_;
+  RoundMultipleStep step_;
+};
+
+/** Several stateless steps run as one filter, without a virtual call or optional between them.
+ *
+ * Code generation fuses runs of consecutive offset, multiply, calibrate, clamp and round filters into one of these.
+ */
+template<typename... Steps> class FusedFilter : public Filter {
+ public:
+  explicit FusedFilter(Steps... steps) : steps_(std::move(steps)...) {}
+  optional<float> new_value(float value) override {
+    if (!this->apply_<0>(value))
+      return {};
+    return value;
+  }
+
+ protected:
+  template<size_t I> typename std::enable_if<(I < sizeof...(Steps)), bool>::type apply_(float &value) const {
+    return std::get<I>(this->steps_).apply(value) && this->apply_<I + 1>(value);
+  }
+  template<size_t I> typename std::enable_if<(I == sizeof...(Steps)), bool>::type apply_(float &value) const {
+    return true;
+  }
+
+  std::tuple<Steps...> steps_;
 };
 
 }  // namespace sensor
@@ -328,6 +328,18 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, Color color) {
     this->buffer_[pos] &= ~(1 << subpos);
   }
 }
+void HOT SSD1306::draw_absolute_span_internal(int x, int y, int w, Color color) {
+  // a row is the same bit in consecutive bytes of a page
+  uint8_t *pos = this->buffer_ + x + (y / 8) * this->get_width_internal();
+  const uint8_t mask = 1 << (y & 0x07);
+  if (color.is_on()) {
+    for (int i = 0; i < w; i++)
+      pos[i] |= mask;
+  } else {
+    for (int i = 0; i < w; i++)
+      pos[i] &= ~mask;
+  }
+}
 void SSD1306::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
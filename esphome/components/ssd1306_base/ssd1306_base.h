@@ -65,6 +65,7 @@ class SSD1306 : public display::DisplayBuffer {
   bool is_ssd1305_() const;
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void draw_absolute_span_internal(int x, int y, int w, Color color) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
@@ -118,6 +118,8 @@ void ST7789V::setup() {
 
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  // the display was cleared above, so only what is drawn from now on needs to be sent
+  this->init_dirty_tiles_();
 }
 
 void ST7789V::dump_config() {
@@ -143,16 +145,21 @@ float ST7789V::get_setup_priority() const { return setup_priority::PROCESSOR; }
 
 void ST7789V::update() {
   this->do_update_();
-  this->write_display_data();
+  this->flush_dirty_regions_();
 }
 
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  this->flush_region_(display::Rect(0, 0, this->get_width_internal(), this->get_height_internal()));
+}
+
+void ST7789V::flush_region_(const display::Rect &region) {
+  uint16_t x1 = this->offset_height_ + region.x;
+  uint16_t x2 = x1 + region.w - 1;
+  uint16_t y1 = this->offset_width_ + region.y;
+  uint16_t y2 = y1 + region.h - 1;
+  const int width = this->get_width_internal();
 
   this->enable();
 
@@ -174,8 +181,8 @@ void ST7789V::write_display_data() {
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (int line = region.y * width; line < region.y2() * width; line = line + width) {
+      for (int index = region.x; index < region.x2(); ++index) {
         auto color = display::ColorUtil::color_to_565(
             display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
@@ -189,8 +196,12 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (region.w == width) {
+    // full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + region.y * width * 2, region.h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int line = region.y; line < region.y2(); line++)
+      this->write_array(this->buffer_ + (line * width + region.x) * 2, region.w * 2);
   }
 
   this->disable();
@@ -296,13 +307,18 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
+    if (this->buffer_[pos] == ((color565 >> 8) & 0xff) && this->buffer_[pos + 1] == (color565 & 0xff))
+      return;
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  this->mark_dirty_(x, y);
 }
 
 }  // namespace st7789v
@@ -22,10 +22,14 @@ void StatusLED::dump_config() {
 void StatusLED::loop() {
   if ((App.get_app_state() & STATUS_LED_ERROR) != 0u) {
     this->pin_->digital_write(millis() % 250u < 150u);
+    this->enable_loop();
   } else if ((App.get_app_state() & STATUS_LED_WARNING) != 0u) {
     this->pin_->digital_write(millis() % 1500u < 250u);
+    this->enable_loop();
   } else {
     this->pin_->digital_write(false);
+    // Application::feed_wdt() keeps calling us, which enables the loop again for blinking
+    this->disable_loop();
   }
 }
 float StatusLED::get_setup_priority() const { return setup_priority::HARDWARE; }
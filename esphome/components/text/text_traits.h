@@ -22,7 +22,7 @@ class TextTraits {
 
   // Set/get the pattern.
   void set_pattern(std::string pattern) { this->pattern_ = std::move(pattern); }
-  std::string get_pattern() const { return this->pattern_; }
+  const std::string &get_pattern() const { return this->pattern_; }
 
   // Set/get the frontend mode.
   void set_mode(TextMode mode) { this->mode_ = mode; }
@@ -272,6 +272,33 @@ void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, Color color
   }
 }
 
+void HOT WaveshareEPaper::draw_absolute_span_internal(int x, int y, int w, Color color) {
+  uint32_t bit = x + y * this->get_width_controller();
+  const uint32_t end = bit + w;
+  // flip logic
+  const bool set = !color.is_on();
+  // whole bytes of the run are written at once, only the partial bytes at either end go bit by bit
+  for (; bit < end && (bit & 0x07) != 0; bit++) {
+    if (set) {
+      this->buffer_[bit / 8u] |= 0x80 >> (bit & 0x07);
+    } else {
+      this->buffer_[bit / 8u] &= ~(0x80 >> (bit & 0x07));
+    }
+  }
+  const uint32_t whole_end = end & ~0x07u;
+  if (bit < whole_end) {
+    memset(this->buffer_ + bit / 8u, set ? 0xFF : 0x00, (whole_end - bit) / 8u);
+    bit = whole_end;
+  }
+  for (; bit < end; bit++) {
+    if (set) {
+      this->buffer_[bit / 8u] |= 0x80 >> (bit & 0x07);
+    } else {
+      this->buffer_[bit / 8u] &= ~(0x80 >> (bit & 0x07));
+    }
+  }
+}
+
 uint32_t WaveshareEPaper::get_buffer_length_() {
   return this->get_width_controller() * this->get_height_internal() / 8u;
 }  // just a black buffer
@@ -69,6 +69,7 @@ class WaveshareEPaper : public WaveshareEPaperBase {
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void draw_absolute_span_internal(int x, int y, int w, Color color) override;
   uint32_t get_buffer_length_() override;
 };
 
@@ -12,6 +12,7 @@
 #include "StreamString.h"
 #endif
 
+#include <cinttypes>
 #include <cstdlib>
 
 #ifdef USE_LIGHT
@@ -38,6 +39,14 @@ namespace esphome {
 namespace web_server {
 
 static const char *const TAG = "web_server";
+/// State events are sent in batches at most this often (ms), only the latest state of each entity is sent
+static const uint32_t STATE_FLUSH_INTERVAL = 100;
+/// Events waiting for a client above which its state events are held back and its log lines dropped
+static const size_t MAX_QUEUED_EVENTS = 8;
+/// States held back for a client that is behind, above this the oldest are dropped
+static const size_t MAX_DEFERRED_STATES = 128;
+/// States held back per entity: one pulse and the last edge
+static const uint8_t MAX_DEFERRED_STATES_PER_ENTITY = 3;
 
 #ifdef USE_WEBSERVER_PRIVATE_NETWORK_ACCESS
 static const char *const HEADER_PNA_NAME = "Private-Network-Access-Name";
@@ -101,34 +110,18 @@ void WebServer::setup() {
   this->setup_controller(this->include_internal_);
   this->base_->init();
 
-  this->events_.onConnect([this](AsyncEventSourceClient *client) {
-    // Configure reconnect timeout and send config
-    client->send(this->get_config_json().c_str(), "ping", millis(), 30000);
-
-    for (auto &group : this->sorting_groups_) {
-      client->send(json::build_json([group](JsonObject root) {
-                     root["name"] = group.second.name;
-                     root["sorting_weight"] = group.second.weight;
-                   }).c_str(),
-                   "sorting_group");
-    }
-
-    this->entities_iterator_.begin(this->include_internal_);
-  });
-
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr && this->expose_log_) {
     logger::global_logger->add_on_log_callback(
-        [this](int level, const char *tag, const char *message) { this->events_.send(message, "log", millis()); });
+        [this](int level, const char *tag, const char *message) { this->send_log_line_(message); });
   }
 #endif
-  this->base_->add_handler(&this->events_);
   this->base_->add_handler(this);
 
   if (this->allow_ota_)
     this->base_->add_ota_handler();
 
-  this->set_interval(10000, [this]() { this->events_.send("", "ping", millis(), 30000); });
+  this->set_interval(10000, [this]() { this->send_event_("", "ping", millis(), 30000); });
 }
 void WebServer::loop() {
 #ifdef USE_ESP32
@@ -147,7 +140,16 @@ void WebServer::loop() {
     }
   }
 #endif
+  // drop the streams of clients that disconnected
+  for (auto it = this->event_clients_.begin(); it != this->event_clients_.end();) {
+    if ((*it)->is_closed()) {
+      it = this->event_clients_.erase(it);
+    } else {
+      ++it;
+    }
+  }
   this->entities_iterator_.advance();
+  this->flush_states_();
 }
 void WebServer::dump_config() {
   ESP_LOGCONFIG(TAG, "Web Server:");
@@ -199,6 +201,40 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 }
 #endif
 
+#ifdef USE_PROFILER
+static void set_json_profile_stats(JsonObject &root, const ProfileStats &stats) {
+  root["count"] = stats.count;
+  root["total_ms"] = uint32_t(stats.total_us / 1000);
+  root["max_us"] = stats.max_us;
+  root["p99_us"] = stats.p99_us();
+}
+void WebServer::handle_profile_request(AsyncWebServerRequest *request) {
+  std::string data = this->profile_json();
+  request->send(200, "application/json", data.c_str());
+}
+std::string WebServer::profile_json() {
+  return json::build_json([](JsonObject root) {
+    JsonArray components = root.createNestedArray("components");
+    for (const auto &entry : App.profiler.get_components()) {
+      JsonObject component = components.createNestedObject();
+      component["source"] = entry.component->get_component_source();
+      component["setup_us"] = entry.setup_us;
+      JsonObject loop = component.createNestedObject("loop");
+      set_json_profile_stats(loop, entry.loop);
+    }
+    JsonArray scheduler_items = root.createNestedArray("scheduler_items");
+    for (const auto &entry : App.profiler.get_scheduler_items()) {
+      JsonObject item = scheduler_items.createNestedObject();
+      item["source"] = entry.component == nullptr ? "<null>" : entry.component->get_component_source();
+      item["name"] = entry.get_display_name();
+      item["name_hash"] = entry.name_hash;
+      set_json_profile_stats(item, entry.stats);
+    }
+    root["dropped_scheduler_items"] = App.profiler.get_dropped_scheduler_items();
+  });
+}
+#endif
+
 #define set_json_id(root, obj, sensor, start_config) \
   (root)["id"] = sensor; \
   if (((start_config) == DETAIL_ALL)) { \
@@ -219,9 +255,12 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<sensor::Sensor *>(entity);
+    return ws->sensor_json(e, e->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (sensor::Sensor *obj : App.get_sensors()) {
@@ -267,9 +306,12 @@ std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail
 
 #ifdef USE_TEXT_SENSOR
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->text_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<text_sensor::TextSensor *>(entity);
+    return ws->text_sensor_json(e, e->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
@@ -306,9 +348,12 @@ std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std:
 
 #ifdef USE_SWITCH
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<switch_::Switch *>(entity);
+    return ws->switch_json(e, e->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (switch_::Switch *obj : App.get_switches()) {
@@ -396,9 +441,18 @@ std::string WebServer::button_json(button::Button *obj, JsonDetail start_config)
 
 #ifdef USE_BINARY_SENSOR
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  // Defer the state itself, a short ON -> OFF pulse must not be merged into its final state
+  if (state) {
+    this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+      return ws->binary_sensor_json(static_cast<binary_sensor::BinarySensor *>(entity), true, DETAIL_STATE);
+    });
+  } else {
+    this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+      return ws->binary_sensor_json(static_cast<binary_sensor::BinarySensor *>(entity), false, DETAIL_STATE);
+    });
+  }
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
@@ -435,9 +489,12 @@ std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool
 
 #ifdef USE_FAN
 void WebServer::on_fan_update(fan::Fan *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<fan::Fan *>(entity);
+    return ws->fan_json(e, DETAIL_STATE);
+  });
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (fan::Fan *obj : App.get_fans()) {
@@ -519,9 +576,12 @@ std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
 
 #ifdef USE_LIGHT
 void WebServer::on_light_update(light::LightState *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->light_json(obj, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<light::LightState *>(entity);
+    return ws->light_json(e, DETAIL_STATE);
+  });
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (light::LightState *obj : App.get_lights()) {
@@ -638,9 +698,12 @@ std::string WebServer::light_json(light::LightState *obj, JsonDetail start_confi
 
 #ifdef USE_COVER
 void WebServer::on_cover_update(cover::Cover *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->cover_json(obj, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<cover::Cover *>(entity);
+    return ws->cover_json(e, DETAIL_STATE);
+  });
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (cover::Cover *obj : App.get_covers()) {
@@ -722,9 +785,12 @@ std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
 
 #ifdef USE_NUMBER
 void WebServer::on_number_update(number::Number *obj, float state) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->number_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<number::Number *>(entity);
+    return ws->number_json(e, e->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_numbers()) {
@@ -796,9 +862,12 @@ std::string WebServer::number_json(number::Number *obj, float value, JsonDetail
 
 #ifdef USE_DATETIME_DATE
 void WebServer::on_date_update(datetime::DateEntity *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->date_json(obj, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<datetime::DateEntity *>(entity);
+    return ws->date_json(e, DETAIL_STATE);
+  });
 }
 void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_dates()) {
@@ -858,9 +927,12 @@ std::string WebServer::date_json(datetime::DateEntity *obj, JsonDetail start_con
 
 #ifdef USE_DATETIME_TIME
 void WebServer::on_time_update(datetime::TimeEntity *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->time_json(obj, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<datetime::TimeEntity *>(entity);
+    return ws->time_json(e, DETAIL_STATE);
+  });
 }
 void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_times()) {
@@ -919,9 +991,12 @@ std::string WebServer::time_json(datetime::TimeEntity *obj, JsonDetail start_con
 
 #ifdef USE_DATETIME_DATETIME
 void WebServer::on_datetime_update(datetime::DateTimeEntity *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->datetime_json(obj, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<datetime::DateTimeEntity *>(entity);
+    return ws->datetime_json(e, DETAIL_STATE);
+  });
 }
 void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_datetimes()) {
@@ -981,9 +1056,12 @@ std::string WebServer::datetime_json(datetime::DateTimeEntity *obj, JsonDetail s
 
 #ifdef USE_TEXT
 void WebServer::on_text_update(text::Text *obj, const std::string &state) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->text_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<text::Text *>(entity);
+    return ws->text_json(e, e->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_texts()) {
@@ -1045,9 +1123,12 @@ std::string WebServer::text_json(text::Text *obj, const std::string &value, Json
 
 #ifdef USE_SELECT
 void WebServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->select_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<select::Select *>(entity);
+    return ws->select_json(e, e->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_selects()) {
@@ -1107,9 +1188,12 @@ std::string WebServer::select_json(select::Select *obj, const std::string &value
 
 #ifdef USE_CLIMATE
 void WebServer::on_climate_update(climate::Climate *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->climate_json(obj, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<climate::Climate *>(entity);
+    return ws->climate_json(e, DETAIL_STATE);
+  });
 }
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_climates()) {
@@ -1268,9 +1352,12 @@ std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_conf
 
 #ifdef USE_LOCK
 void WebServer::on_lock_update(lock::Lock *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<lock::Lock *>(entity);
+    return ws->lock_json(e, e->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (lock::Lock *obj : App.get_locks()) {
@@ -1319,9 +1406,12 @@ std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDet
 
 #ifdef USE_VALVE
 void WebServer::on_valve_update(valve::Valve *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->valve_json(obj, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<valve::Valve *>(entity);
+    return ws->valve_json(e, DETAIL_STATE);
+  });
 }
 void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (valve::Valve *obj : App.get_valves()) {
@@ -1394,9 +1484,12 @@ std::string WebServer::valve_json(valve::Valve *obj, JsonDetail start_config) {
 
 #ifdef USE_ALARM_CONTROL_PANEL
 void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    auto *e = static_cast<alarm_control_panel::AlarmControlPanel *>(entity);
+    return ws->alarm_control_panel_json(e, e->get_state(), DETAIL_STATE);
+  });
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
@@ -1461,7 +1554,7 @@ std::string WebServer::alarm_control_panel_json(alarm_control_panel::AlarmContro
 
 #ifdef USE_EVENT
 void WebServer::on_event(event::Event *obj, const std::string &event_type) {
-  this->events_.send(this->event_json(obj, event_type, DETAIL_STATE).c_str(), "state");
+  this->send_event_(this->event_json(obj, event_type, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_event_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (event::Event *obj : App.get_events()) {
@@ -1506,9 +1599,11 @@ std::string WebServer::event_json(event::Event *obj, const std::string &event_ty
 
 #ifdef USE_UPDATE
 void WebServer::on_update(update::UpdateEntity *obj) {
-  if (this->events_.count() == 0)
+  if (this->event_clients_.empty())
     return;
-  this->events_.send(this->update_json(obj, DETAIL_STATE).c_str(), "state");
+  this->defer_state_(obj, [](WebServer *ws, EntityBase *entity) {
+    return ws->update_json(static_cast<update::UpdateEntity *>(entity), DETAIL_STATE);
+  });
 }
 void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (update::UpdateEntity *obj : App.get_updates()) {
@@ -1575,6 +1670,9 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) {
   if (request->url() == "/")
     return true;
 
+  if (request->url() == "/events" && request->method() == HTTP_GET)
+    return true;
+
 #ifdef USE_WEBSERVER_CSS_INCLUDE
   if (request->url() == "/0.css")
     return true;
@@ -1597,6 +1695,11 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) {
   }
 #endif
 
+#ifdef USE_PROFILER
+  if (request->method() == HTTP_GET && request->url() == "/debug/profile")
+    return true;
+#endif
+
   UrlMatch match = match_url(request->url().c_str(), true);
   if (!match.valid)
     return false;
@@ -1708,6 +1811,11 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
     return;
   }
 
+  if (request->url() == "/events") {
+    this->handle_events_request_(request);
+    return;
+  }
+
 #ifdef USE_WEBSERVER_CSS_INCLUDE
   if (request->url() == "/0.css") {
     this->handle_css_request(request);
@@ -1729,6 +1837,13 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
   }
 #endif
 
+#ifdef USE_PROFILER
+  if (request->url() == "/debug/profile") {
+    this->handle_profile_request(request);
+    return;
+  }
+#endif
+
   UrlMatch match = match_url(request->url().c_str());
 #ifdef USE_SENSOR
   if (match.domain == "sensor") {
@@ -1876,6 +1991,133 @@ void WebServer::add_sorting_group(uint64_t group_id, const std::string &group_na
   this->sorting_groups_[group_id] = SortingGroup{group_name, weight};
 }
 
+bool WebServer::EventClient::is_behind() {
+#ifdef USE_ARDUINO
+  // every client has its own event source, so this is the queue of this client only
+  return this->source.avgPacketsWaiting() >= MAX_QUEUED_EVENTS;
+#else
+  // the ESP-IDF event source sends right away
+  return false;
+#endif
+}
+
+bool WebServer::EventClient::is_closed() const {
+  if (this->connected)
+    return this->source.count() == 0;
+  // until the stream opens, the pending response of the request refers to the source
+  return this->abandoned;
+}
+
+void WebServer::EventClient::defer_state(EntityBase *entity, state_json_t json) {
+  auto it = this->deferred_index.find(entity);
+  if (it != this->deferred_index.end()) {
+    DeferredState &latest = this->deferred_states[it->second.latest];
+    if (latest.json == json)
+      return;
+    // a flapping entity keeps its first pulse, later edges replace the last one
+    if (it->second.count >= MAX_DEFERRED_STATES_PER_ENTITY) {
+      latest.json = json;
+      return;
+    }
+  }
+  if (this->deferred_states.size() >= MAX_DEFERRED_STATES) {
+    this->deferred_states.erase(this->deferred_states.begin());
+    this->index_states();
+  }
+  DeferredSlot &slot = this->deferred_index[entity];
+  slot.latest = this->deferred_states.size();
+  slot.count++;
+  this->deferred_states.push_back(DeferredState{entity, json});
+}
+
+void WebServer::EventClient::index_states() {
+  this->deferred_index.clear();
+  for (size_t i = 0; i < this->deferred_states.size(); i++) {
+    DeferredSlot &slot = this->deferred_index[this->deferred_states[i].entity];
+    slot.latest = i;
+    slot.count++;
+  }
+}
+
+void WebServer::EventClient::flush_states(WebServer *ws) {
+  size_t sent = 0;
+  // while the client is behind, keep its states deferred, later changes of the same entity replace them
+  while (sent < this->deferred_states.size() && !this->is_behind()) {
+    const DeferredState &state = this->deferred_states[sent];
+    this->source.send(state.json(ws, state.entity).c_str(), "state");
+    sent++;
+  }
+  if (sent == 0)
+    return;
+  this->deferred_states.erase(this->deferred_states.begin(), this->deferred_states.begin() + sent);
+  this->index_states();
+}
+
+void WebServer::defer_state_(EntityBase *entity, state_json_t json) {
+  for (auto &client : this->event_clients_)
+    client->defer_state(entity, json);
+}
+
+void WebServer::flush_states_() {
+  const uint32_t now = millis();
+  if (now - this->last_state_flush_ < STATE_FLUSH_INTERVAL)
+    return;
+  this->last_state_flush_ = now;
+  for (auto &client : this->event_clients_)
+    client->flush_states(this);
+}
+
+void WebServer::handle_events_request_(AsyncWebServerRequest *request) {
+  auto *client = new EventClient();  // NOLINT(cppcoreguidelines-owning-memory)
+#ifdef USE_ARDUINO
+  // the stream opens asynchronously, the request only reports a disconnect that happens before that
+  request->onDisconnect([client]() {
+    if (!client->connected)
+      client->abandoned = true;
+  });
+#endif
+  client->source.onConnect([this, client](AsyncEventSourceClient *source_client) {
+    client->connected = true;
+    // Configure reconnect timeout and send config
+    source_client->send(this->get_config_json().c_str(), "ping", millis(), 30000);
+
+    for (auto &group : this->sorting_groups_) {
+      source_client->send(json::build_json([group](JsonObject root) {
+                            root["name"] = group.second.name;
+                            root["sorting_weight"] = group.second.weight;
+                          }).c_str(),
+                          "sorting_group");
+    }
+
+    this->entities_iterator_.begin(this->include_internal_);
+  });
+  client->source.handleRequest(request);
+  // the list of clients belongs to the main loop
+  this->schedule_([this, client]() { this->event_clients_.emplace_back(client); });
+}
+
+void WebServer::send_event_(const char *message, const char *event, uint32_t id, uint32_t reconnect) {
+  for (auto &client : this->event_clients_)
+    client->source.send(message, event, id, reconnect);
+}
+
+void WebServer::send_log_line_(const char *message) {
+  for (auto &client : this->event_clients_) {
+    // drop log lines rather than queueing more for a client that is already behind
+    if (client->is_behind()) {
+      client->dropped_log_lines++;
+      continue;
+    }
+    if (client->dropped_log_lines != 0) {
+      const std::string dropped = str_sprintf("[W][web_server]: %" PRIu32 " log lines dropped, the client fell behind",
+                                              client->dropped_log_lines);
+      client->source.send(dropped.c_str(), "log", millis());
+      client->dropped_log_lines = 0;
+    }
+    client->source.send(message, "log", millis());
+  }
+}
+
 void WebServer::schedule_(std::function<void()> &&f) {
 #ifdef USE_ESP32
   xSemaphoreTake(this->to_schedule_lock_, portMAX_DELAY);
@@ -8,7 +8,10 @@
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #ifdef USE_ESP32
 #include <freertos/FreeRTOS.h>
@@ -148,6 +151,14 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   void handle_pna_cors_request(AsyncWebServerRequest *request);
 #endif
 
+#ifdef USE_PROFILER
+  /// Handle a profiler request under '/debug/profile'.
+  void handle_profile_request(AsyncWebServerRequest *request);
+
+  /// Dump the run time statistics of all components and scheduler items as a JSON string.
+  std::string profile_json();
+#endif
+
 #ifdef USE_SENSOR
   void on_sensor_update(sensor::Sensor *obj, float state) override;
   /// Handle a sensor request under '/sensor/<id>'.
@@ -350,13 +361,54 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   void add_sorting_group(uint64_t group_id, const std::string &group_name, float weight);
 
  protected:
+  using state_json_t = std::string (*)(WebServer *, EntityBase *);
+  struct DeferredState {
+    EntityBase *entity;
+    state_json_t json;
+  };
+  struct DeferredSlot {
+    /// Index of the latest deferred state of the entity
+    size_t latest{0};
+    /// Number of deferred states of the entity
+    uint8_t count{0};
+  };
+  /// The event stream of one client. Every client has its own, so one that falls behind only holds back itself.
+  struct EventClient {
+    AsyncEventSource source{"/events"};
+    /// States waiting to be sent. One per entity, unless they carry the state themselves (binary sensors): then at
+    /// most one pulse and the last edge.
+    std::vector<DeferredState> deferred_states;
+    std::unordered_map<EntityBase *, DeferredSlot> deferred_index;
+    uint32_t dropped_log_lines{0};
+    /// Set from the web server task once the stream is open.
+    std::atomic<bool> connected{false};
+    /// Set from the web server task when the request closed before the stream opened.
+    std::atomic<bool> abandoned{false};
+
+    /// Whether the client has too many events waiting to take more right now.
+    bool is_behind();
+    /// Whether nothing refers to the event source any more, so it can be deleted.
+    bool is_closed() const;
+    void defer_state(EntityBase *entity, state_json_t json);
+    void flush_states(WebServer *ws);
+    void index_states();
+  };
+  /// Send the state of this entity to every client with the next batch of state events.
+  void defer_state_(EntityBase *entity, state_json_t json);
+  void flush_states_();
+  void handle_events_request_(AsyncWebServerRequest *request);
+  /// Send an event to every client.
+  void send_event_(const char *message, const char *event, uint32_t id = 0, uint32_t reconnect = 0);
+  void send_log_line_(const char *message);
+
   void schedule_(std::function<void()> &&f);
   friend ListEntitiesIterator;
   web_server_base::WebServerBase *base_;
-  AsyncEventSource events_{"/events"};
+  std::vector<std::unique_ptr<EventClient>> event_clients_;
   ListEntitiesIterator entities_iterator_;
   std::map<EntityBase *, SortingComponents> sorting_entitys_;
   std::map<uint64_t, SortingGroup> sorting_groups_;
+  uint32_t last_state_flush_{0};
 
 #if USE_WEBSERVER_VERSION == 1
   const char *css_url_{nullptr};
@@ -26,16 +26,30 @@ void Application::register_component_(Component *comp) {
   this->components_.push_back(comp);
 }
 void Application::setup() {
+#if defined(USE_ESP32)
+  this->loop_task_handle_ = xTaskGetCurrentTaskHandle();
+#elif defined(USE_HOST)
+  this->loop_thread_id_ = std::this_thread::get_id();
+#endif
   ESP_LOGI(TAG, "Running through setup()...");
   ESP_LOGV(TAG, "Sorting components by setup priority...");
   std::stable_sort(this->components_.begin(), this->components_.end(), [](const Component *a, const Component *b) {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
   });
+#ifdef USE_PROFILER
+  this->profiler.init(this->components_);
+#endif
 
   for (uint32_t i = 0; i < this->components_.size(); i++) {
     Component *component = this->components_[i];
 
+#ifdef USE_PROFILER
+    const uint32_t setup_start = micros();
+    component->call();
+    this->profiler.record_setup(component, micros() - setup_start);
+#else
     component->call();
+#endif
     this->scheduler.process_to_add();
     this->feed_wdt();
     if (component->can_proceed())
@@ -65,13 +79,30 @@ void Application::setup() {
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
+  bool all_idle = true;
 
   this->scheduler.call();
   this->feed_wdt();
   for (Component *component : this->looping_components_) {
+    if (component->pending_enable_loop_) {
+      component->pending_enable_loop_ = false;
+      component->loop_disabled_ = false;
+    }
+    if (component->loop_disabled_) {
+      new_app_state |= component->get_component_state();
+      this->app_state_ |= new_app_state;
+      continue;
+    }
+    all_idle = false;
     {
       WarnIfComponentBlockingGuard guard{component};
+#ifdef USE_PROFILER
+      const uint32_t loop_start = micros();
+      component->call();
+      this->profiler.record_loop(component, micros() - loop_start);
+#else
       component->call();
+#endif
     }
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
@@ -86,12 +117,25 @@ void Application::loop() {
     yield();
   } else {
     uint32_t delay_time = this->loop_interval_ - elapsed;
-    uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
-    // next_schedule is max 0.5*delay_time
-    // otherwise interval=0 schedules result in constant looping with almost no sleep
-    next_schedule = std::max(next_schedule, delay_time / 2);
-    delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+#if defined(USE_ESP32) || defined(USE_HOST)
+    if (all_idle && this->dump_config_at_ >= this->components_.size()) {
+      // Nothing to poll: sleep until the next timer is due or a component is woken up. Timers set by the
+      // components in this iteration are still pending, move them into the heap so they are taken into account.
+      this->scheduler.process_to_add();
+      uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(MAX_IDLE_SLEEP_MS);
+      // same floor as below, interval=0 schedules must not turn this into a busy loop
+      next_schedule = std::max(next_schedule, delay_time / 2);
+      delay_time = std::min(next_schedule, MAX_IDLE_SLEEP_MS);
+    } else
+#endif
+    {
+      uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
+      // next_schedule is max 0.5*delay_time
+      // otherwise interval=0 schedules result in constant looping with almost no sleep
+      next_schedule = std::max(next_schedule, delay_time / 2);
+      delay_time = std::min(next_schedule, delay_time);
+    }
+    this->sleep_until_woken_(delay_time);
   }
   this->last_loop_ = now;
 
@@ -121,6 +165,44 @@ void IRAM_ATTR HOT Application::feed_wdt() {
 #endif
   }
 }
+void IRAM_ATTR Application::wake_loop_any_context() {
+#if defined(USE_ESP32)
+  if (this->loop_task_handle_ == nullptr)
+    return;
+  if (xPortInIsrContext()) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(this->loop_task_handle_, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+  } else if (xTaskGetCurrentTaskHandle() != this->loop_task_handle_) {
+    // The loop task is awake if it is the one calling us, no need to cut its next sleep short
+    xTaskNotifyGive(this->loop_task_handle_);
+  }
+#elif defined(USE_HOST)
+  if (std::this_thread::get_id() == this->loop_thread_id_)
+    return;
+  {
+    std::lock_guard<std::mutex> guard(this->wake_lock_);
+    this->wake_requested_ = true;
+  }
+  this->wake_cv_.notify_one();
+#endif
+}
+void Application::sleep_until_woken_(uint32_t delay_ms) {
+#if defined(USE_ESP32)
+  const TickType_t ticks = pdMS_TO_TICKS(delay_ms);
+  if (ticks == 0) {
+    yield();
+    return;
+  }
+  ulTaskNotifyTake(pdTRUE, ticks);
+#elif defined(USE_HOST)
+  std::unique_lock<std::mutex> lock(this->wake_lock_);
+  this->wake_cv_.wait_for(lock, std::chrono::milliseconds(delay_ms), [this] { return this->wake_requested_; });
+  this->wake_requested_ = false;
+#else
+  delay(delay_ms);
+#endif
+}
 void Application::reboot() {
   ESP_LOGI(TAG, "Forcing a reboot...");
   for (auto it = this->components_.rbegin(); it != this->components_.rend(); ++it) {
@@ -7,8 +7,19 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/preferences.h"
+#include "esphome/core/profiler.h"
 #include "esphome/core/scheduler.h"
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+#ifdef USE_HOST
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -235,6 +246,13 @@ class Application {
 
   void feed_wdt();
 
+  /** Wake up the main loop if it is sleeping at the end of loop().
+   *
+   * Safe to call from an ISR or another task. On platforms without a wakeup primitive the loop simply
+   * picks up the work after its regular loop interval.
+   */
+  void wake_loop_any_context();
+
   void reboot();
 
   void safe_reboot();
@@ -461,6 +479,10 @@ class Application {
 
   Scheduler scheduler;
 
+#ifdef USE_PROFILER
+  Profiler profiler;
+#endif
+
  protected:
   friend Component;
 
@@ -470,6 +492,9 @@ class Application {
 
   void feed_wdt_arch_();
 
+  /// Sleep for up to \p delay_ms, returning early if wake_loop_any_context() is called.
+  void sleep_until_woken_(uint32_t delay_ms);
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
@@ -545,8 +570,19 @@ class Application {
   bool name_add_mac_suffix_;
   uint32_t last_loop_{0};
   uint32_t loop_interval_{16};
+  /// Upper bound for sleeping while every looping component is idle, keeps the task watchdog fed.
+  static constexpr uint32_t MAX_IDLE_SLEEP_MS = 1000;
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
+#ifdef USE_ESP32
+  TaskHandle_t loop_task_handle_{nullptr};
+#endif
+#ifdef USE_HOST
+  std::thread::id loop_thread_id_{};
+  std::mutex wake_lock_;
+  std::condition_variable wake_cv_;
+  bool wake_requested_{false};
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
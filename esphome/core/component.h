@@ -142,6 +142,29 @@ class Component {
 
   bool has_overridden_loop() const;
 
+  /** Stop calling loop() for this component until it is enabled again.
+   *
+   * Components that only have work to do after an external event (an interrupt, a callback from another task)
+   * can call this from loop() once they are idle. The main loop then skips them and, if every looping component
+   * is idle, sleeps until the next scheduled timer or until it is woken up by enable_loop().
+   *
+   * On ESP32 that sleep waits on the notification of the loop task, which is owned by the core. Components must not
+   * call ulTaskNotifyTake()/xTaskNotifyGive() on the loop task themselves, use enable_loop_soon_any_context() or
+   * App.wake_loop_any_context() instead.
+   */
+  void disable_loop();
+
+  /// Resume calling loop() for this component after disable_loop(). Must be called from the main loop task.
+  void enable_loop();
+
+  /** Same as enable_loop(), but safe to call from an ISR or another task.
+   *
+   * The request is picked up by the next iteration of the main loop, which is woken up if it is sleeping.
+   */
+  void enable_loop_soon_any_context();
+
+  bool is_loop_disabled() const { return this->loop_disabled_; }
+
   /** Set where this component was loaded from for some debug messages.
    *
    * This is set by the ESPHome core, and should not be called manually.
@@ -177,6 +200,11 @@ class Component {
    */
   void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);  // NOLINT
 
+  /// Same as above for string literal names, which are not copied. Other C strings use the std::string overload.
+  template<size_t N> void set_interval(const char (&name)[N], uint32_t interval, std::function<void()> &&f) {  // NOLINT
+    this->set_interval_static_(name, interval, std::move(f));
+  }
+
   void set_interval(uint32_t interval, std::function<void()> &&f);  // NOLINT
 
   /** Cancel an interval function.
@@ -185,6 +213,7 @@ class Component {
    * @return Whether an interval functions was deleted.
    */
   bool cancel_interval(const std::string &name);  // NOLINT
+  bool cancel_interval(const char *name);         // NOLINT
 
   /** Set an retry function with a unique name. Empty name means no cancelling possible.
    *
@@ -219,6 +248,13 @@ class Component {
   void set_retry(const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,       // NOLINT
                  std::function<RetryResult(uint8_t)> &&f, float backoff_increase_factor = 1.0f);  // NOLINT
 
+  /// Same as above for string literal names, which are not copied. Other C strings use the std::string overload.
+  template<size_t N>
+  void set_retry(const char (&name)[N], uint32_t initial_wait_time, uint8_t max_attempts,         // NOLINT
+                 std::function<RetryResult(uint8_t)> &&f, float backoff_increase_factor = 1.0f) {  // NOLINT
+    this->set_retry_static_(name, initial_wait_time, max_attempts, std::move(f), backoff_increase_factor);
+  }
+
   void set_retry(uint32_t initial_wait_time, uint8_t max_attempts, std::function<RetryResult(uint8_t)> &&f,  // NOLINT
                  float backoff_increase_factor = 1.0f);                                                      // NOLINT
 
@@ -228,6 +264,7 @@ class Component {
    * @return Whether a retry function was deleted.
    */
   bool cancel_retry(const std::string &name);  // NOLINT
+  bool cancel_retry(const char *name);         // NOLINT
 
   /** Set a timeout function with a unique name.
    *
@@ -245,6 +282,11 @@ class Component {
    */
   void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
+  /// Same as above for string literal names, which are not copied. Other C strings use the std::string overload.
+  template<size_t N> void set_timeout(const char (&name)[N], uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+    this->set_timeout_static_(name, timeout, std::move(f));
+  }
+
   void set_timeout(uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
   /** Cancel a timeout function.
@@ -253,6 +295,7 @@ class Component {
    * @return Whether a timeout functions was deleted.
    */
   bool cancel_timeout(const std::string &name);  // NOLINT
+  bool cancel_timeout(const char *name);         // NOLINT
 
   /** Defer a callback to the next loop() call.
    *
@@ -263,15 +306,29 @@ class Component {
    */
   void defer(const std::string &name, std::function<void()> &&f);  // NOLINT
 
+  /// Same as above for string literal names, which are not copied. Other C strings use the std::string overload.
+  template<size_t N> void defer(const char (&name)[N], std::function<void()> &&f) {  // NOLINT
+    this->set_timeout_static_(name, 0, std::move(f));
+  }
+
   /// Defer a callback to the next loop() call.
   void defer(std::function<void()> &&f);  // NOLINT
 
   /// Cancel a defer callback using the specified name, name must not be empty.
   bool cancel_defer(const std::string &name);  // NOLINT
+  bool cancel_defer(const char *name);         // NOLINT
+
+  // Entry points of the string literal overloads above, \p name is stored by pointer
+  void set_interval_static_(const char *name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+  void set_retry_static_(const char *name, uint32_t initial_wait_time, uint8_t max_attempts,  // NOLINT
+                         std::function<RetryResult(uint8_t)> &&f, float backoff_increase_factor);
+  void set_timeout_static_(const char *name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
+  bool loop_disabled_{false};
+  volatile bool pending_enable_loop_{false};
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -74,6 +74,7 @@
 #define USE_OTA_VERSION 1
 #define USE_OUTPUT
 #define USE_POWER_SUPPLY
+#define USE_PROFILER
 #define USE_QR_CODE
 #define USE_SELECT
 #define USE_SENSOR
@@ -109,6 +110,7 @@
 #define USE_ESP32_BLE_CLIENT
 #define USE_ESP32_BLE_SERVER
 #define USE_ESP32_CAMERA
+#define USE_ESPHOME_TASK_LOG_BUFFER
 #define USE_IMPROV
 #define USE_MICRO_WAKE_WORD_VAD
 #define USE_MICROPHONE
@@ -53,6 +53,13 @@ std::string EntityBase::get_object_id() const {
     return this->object_id_c_str_;
   }
 }
+StringRef EntityBase::get_object_id_ref(std::string &buf) const {
+  if (!this->has_own_name_ && App.is_name_add_mac_suffix_enabled()) {
+    buf = str_sanitize(str_snake_case(App.get_friendly_name()));
+    return StringRef(buf);
+  }
+  return StringRef::from_maybe_nullptr(this->object_id_c_str_);
+}
 void EntityBase::set_object_id(const char *object_id) {
   this->object_id_c_str_ = object_id;
   this->calc_object_id_();
@@ -25,6 +25,9 @@ class EntityBase {
   // Get the sanitized name of this Entity as an ID.
   std::string get_object_id() const;
   void set_object_id(const char *object_id);
+  // Get the object ID without copying it. `buf` is only written (and must outlive the result) when the object ID is
+  // derived from the dynamic friendly name.
+  StringRef get_object_id_ref(std::string &buf) const;
 
   // Get the unique Object ID of this Entity
   uint32_t get_object_id_hash();
@@ -45,6 +48,7 @@ class EntityBase {
 
   // Get/set this entity's icon
   std::string get_icon() const;
+  StringRef get_icon_ref() const { return StringRef::from_maybe_nullptr(this->icon_c_str_); }
   void set_icon(const char *icon);
 
  protected:
@@ -67,6 +71,8 @@ class EntityBase_DeviceClass {  // NOLINT(readability-identifier-naming)
  public:
   /// Get the device class, using the manual override if set.
   std::string get_device_class();
+  /// Get the device class without copying it.
+  StringRef get_device_class_ref() const { return StringRef::from_maybe_nullptr(this->device_class_); }
   /// Manually set the device class.
   void set_device_class(const char *device_class);
 
@@ -78,6 +84,8 @@ class EntityBase_UnitOfMeasurement {  // NOLINT(readability-identifier-naming)
  public:
   /// Get the unit of measurement, using the manual override if set.
   std::string get_unit_of_measurement();
+  /// Get the unit of measurement without copying it.
+  StringRef get_unit_of_measurement_ref() const { return StringRef::from_maybe_nullptr(this->unit_of_measurement_); }
   /// Manually set the unit of measurement.
   void set_unit_of_measurement(const char *unit_of_measurement);
 
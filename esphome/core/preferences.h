@@ -54,6 +54,16 @@ class ESPPreferences {
    */
   virtual bool reset() = 0;
 
+  /// What sync() did since boot, on the platforms that keep track of it.
+  struct SyncStats {
+    /// Preferences written to flash
+    uint32_t writes{0};
+    uint32_t bytes_written{0};
+    /// Saves that were not written because flash already held the same data
+    uint32_t skipped{0};
+  };
+  const SyncStats &get_sync_stats() const { return this->sync_stats_; }
+
   template<typename T, enable_if_t<is_trivially_copyable<T>::value, bool> = true>
   ESPPreferenceObject make_preference(uint32_t type, bool in_flash) {
     return this->make_preference(sizeof(T), type, in_flash);
@@ -63,6 +73,9 @@ class ESPPreferences {
   ESPPreferenceObject make_preference(uint32_t type) {
     return this->make_preference(sizeof(T), type);
   }
+
+ protected:
+  SyncStats sync_stats_{};
 };
 
 extern ESPPreferences *global_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
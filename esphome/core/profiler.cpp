@@ -0,0 +1,100 @@
+#include "esphome/core/profiler.h"
+
+#ifdef USE_PROFILER
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+
+void HOT ProfileStats::record(uint32_t duration_us) {
+  this->count++;
+  this->total_us += duration_us;
+  if (duration_us > this->max_us)
+    this->max_us = duration_us;
+  uint8_t bucket = 0;
+  while (bucket < HISTOGRAM_BUCKETS - 1 && duration_us >= (1UL << bucket))
+    bucket++;
+  this->histogram[bucket]++;
+}
+uint32_t ProfileStats::p99_us() const {
+  if (this->count == 0)
+    return 0;
+  // Number of runs that may be above the returned value
+  const uint32_t allowed_above = this->count / 100;
+  uint32_t above = 0;
+  for (uint8_t bucket = HISTOGRAM_BUCKETS - 1; bucket > 0; bucket--) {
+    above += this->histogram[bucket];
+    if (above <= allowed_above)
+      continue;
+    // The last bucket has no upper bound
+    if (bucket == HISTOGRAM_BUCKETS - 1)
+      return this->max_us;
+    return std::min(this->max_us, uint32_t(1UL << bucket));
+  }
+  return 0;
+}
+
+void Profiler::init(const std::vector<Component *> &components) {
+  this->components_.clear();
+  this->components_.reserve(components.size());
+  for (auto *component : components)
+    this->components_.push_back(ComponentEntry{component, 0, {}});
+  std::sort(this->components_.begin(), this->components_.end(),
+            [](const ComponentEntry &a, const ComponentEntry &b) { return a.component < b.component; });
+  this->scheduler_items_.reserve(MAX_SCHEDULER_ITEMS);
+}
+Profiler::ComponentEntry *HOT Profiler::find_component_(Component *component) {
+  auto it = std::lower_bound(
+      this->components_.begin(), this->components_.end(), component,
+      [](const ComponentEntry &entry, const Component *component) { return entry.component < component; });
+  if (it == this->components_.end() || it->component != component)
+    return nullptr;
+  return &*it;
+}
+void Profiler::record_setup(Component *component, uint32_t duration_us) {
+  auto *entry = this->find_component_(component);
+  if (entry != nullptr)
+    entry->setup_us = duration_us;
+}
+void HOT Profiler::record_loop(Component *component, uint32_t duration_us) {
+  auto *entry = this->find_component_(component);
+  if (entry != nullptr)
+    entry->loop.record(duration_us);
+}
+void HOT Profiler::record_scheduler(Component *component, const char *type, const char *name, uint32_t name_hash,
+                                    uint32_t duration_us) {
+  if (name == nullptr)
+    name = "";
+  for (auto &entry : this->scheduler_items_) {
+    // type strings are static, so comparing the pointers is enough
+    if (entry.component == component && entry.name_hash == name_hash && entry.type == type &&
+        strncmp(entry.name, name, MAX_SCHEDULER_NAME_LENGTH) == 0) {
+      entry.stats.record(duration_us);
+      return;
+    }
+  }
+  if (this->scheduler_items_.size() >= MAX_SCHEDULER_ITEMS) {
+    this->dropped_scheduler_items_++;
+    return;
+  }
+  // The scheduler reuses its items, so the name has to be copied
+  this->scheduler_items_.push_back(SchedulerEntry{component, type, {}, name_hash, {}});
+  SchedulerEntry &entry = this->scheduler_items_.back();
+  strncpy(entry.name, name, MAX_SCHEDULER_NAME_LENGTH);
+  entry.name[MAX_SCHEDULER_NAME_LENGTH] = '\0';
+  entry.stats.record(duration_us);
+}
+void Profiler::reset() {
+  for (auto &entry : this->components_)
+    entry.loop = ProfileStats{};
+  this->scheduler_items_.clear();
+  this->dropped_scheduler_items_ = 0;
+}
+
+}  // namespace esphome
+
+#endif  // USE_PROFILER
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_PROFILER
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome {
+
+class Component;
+
+/// Run time statistics of a profiled section, i.e. a component's loop() or a scheduler callback.
+struct ProfileStats {
+  /// Bucket `i` of the histogram counts runs that took less than 2^i µs, the last bucket counts all longer runs.
+  static const uint8_t HISTOGRAM_BUCKETS = 20;
+
+  uint32_t count{0};
+  uint64_t total_us{0};
+  uint32_t max_us{0};
+  uint32_t histogram[HISTOGRAM_BUCKETS]{};
+
+  void record(uint32_t duration_us);
+  /// Upper bound of the run time of 99% of all runs in µs, with the resolution of the histogram buckets.
+  uint32_t p99_us() const;
+};
+
+/** Collects run time statistics for every component and scheduler item.
+ *
+ * All tables are allocated once in init() and never grow afterwards, so recording a sample never allocates.
+ * Recording must only happen from the main loop task.
+ */
+class Profiler {
+ public:
+  /// Maximum number of distinct scheduler items that are tracked, further items are counted as dropped.
+  static const uint8_t MAX_SCHEDULER_ITEMS = 32;
+  /// Scheduler item names are cut to this many characters, items are still told apart by the hash of the full name.
+  static const uint8_t MAX_SCHEDULER_NAME_LENGTH = 31;
+
+  struct ComponentEntry {
+    Component *component;
+    uint32_t setup_us;
+    ProfileStats loop;
+  };
+
+  struct SchedulerEntry {
+    Component *component;
+    /// "timeout", "interval" or "retry", anonymous items of a component are told apart by this only.
+    const char *type;
+    /// Copied when the item is first recorded, empty for anonymous items.
+    char name[MAX_SCHEDULER_NAME_LENGTH + 1];
+    uint32_t name_hash;
+    ProfileStats stats;
+
+    /// The name, or the type in angle brackets for anonymous items.
+    std::string get_display_name() const {
+      return this->name[0] == '\0' ? std::string("<") + this->type + ">" : std::string(this->name);
+    }
+  };
+
+  void init(const std::vector<Component *> &components);
+
+  void record_setup(Component *component, uint32_t duration_us);
+  void record_loop(Component *component, uint32_t duration_us);
+  void record_scheduler(Component *component, const char *type, const char *name, uint32_t name_hash,
+                        uint32_t duration_us);
+
+  /// Clear all collected statistics, the setup times are kept.
+  void reset();
+
+  const std::vector<ComponentEntry> &get_components() const { return this->components_; }
+  const std::vector<SchedulerEntry> &get_scheduler_items() const { return this->scheduler_items_; }
+  uint32_t get_dropped_scheduler_items() const { return this->dropped_scheduler_items_; }
+
+ protected:
+  ComponentEntry *find_component_(Component *component);
+
+  /// Sorted by component pointer for binary search.
+  std::vector<ComponentEntry> components_;
+  std::vector<SchedulerEntry> scheduler_items_;
+  uint32_t dropped_scheduler_items_{0};
+};
+
+}  // namespace esphome
+
+#endif  // USE_PROFILER
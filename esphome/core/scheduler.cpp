@@ -1,15 +1,22 @@
 #include "scheduler.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/hal.h"
 #include <algorithm>
 #include <cinttypes>
+#include <cstring>
 
 namespace esphome {
 
 static const char *const TAG = "scheduler";
 
 static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+// Upper bound for the number of idle items kept around for reuse
+static const size_t MAX_POOL_SIZE = 16;
+
+// Items are looked up by the FNV-1 hash of their name, the names are only compared on a hash match.
+static inline uint32_t hash_name(const char *name) { return fnv1_hash(name == nullptr ? "" : name); }
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
@@ -17,66 +24,124 @@ static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
 // A note on locking: the `lock_` lock protects the `items_` and `to_add_` containers. It must be taken when writing to
 // them (i.e. when adding/removing items, but not when changing items). As items are only deleted from the loop task,
 // iterating over them from the loop task is fine; but iterating from any other context requires the lock to be held to
-// avoid the main thread modifying the list while it is being accessed.
+// avoid the main thread modifying the list while it is being accessed. The item pool is protected by the same lock.
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> func) {
-  const uint32_t now = this->millis_();
-
-  if (!name.empty())
-    this->cancel_timeout(component, name);
-
-  if (timeout == SCHEDULER_DONT_RUN)
-    return;
-
-  ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
-
-  auto item = make_unique<SchedulerItem>();
-  item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::TIMEOUT;
-  item->timeout = timeout;
-  item->last_execution = now;
-  item->last_execution_major = this->millis_major_;
-  item->callback = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  this->set_timer_(component, SchedulerItem::TIMEOUT, name.c_str(), false, fnv1_hash(name), !name.empty(), timeout,
+                   std::move(func));
+}
+void HOT Scheduler::set_timeout_static_(Component *component, const char *name, uint32_t timeout,
+                                        std::function<void()> func) {
+  this->set_timer_(component, SchedulerItem::TIMEOUT, name, true, hash_name(name), *name != '\0', timeout,
+                   std::move(func));
+}
+void HOT Scheduler::set_timeout(Component *component, uint32_t id, uint32_t timeout, std::function<void()> func) {
+  this->set_timer_(component, SchedulerItem::TIMEOUT, nullptr, false, id, true, timeout, std::move(func));
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
+  return this->cancel_item_(component, fnv1_hash(name), name.c_str(), SchedulerItem::TIMEOUT);
+}
+bool HOT Scheduler::cancel_timeout_static_(Component *component, const char *name) {
+  return this->cancel_item_(component, hash_name(name), name, SchedulerItem::TIMEOUT);
+}
+bool HOT Scheduler::cancel_timeout(Component *component, uint32_t id) {
+  return this->cancel_item_(component, id, nullptr, SchedulerItem::TIMEOUT);
 }
 void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
                                  std::function<void()> func) {
+  this->set_timer_(component, SchedulerItem::INTERVAL, name.c_str(), false, fnv1_hash(name), !name.empty(), interval,
+                   std::move(func));
+}
+void HOT Scheduler::set_interval_static_(Component *component, const char *name, uint32_t interval,
+                                         std::function<void()> func) {
+  this->set_timer_(component, SchedulerItem::INTERVAL, name, true, hash_name(name), *name != '\0', interval,
+                   std::move(func));
+}
+void HOT Scheduler::set_interval(Component *component, uint32_t id, uint32_t interval, std::function<void()> func) {
+  this->set_timer_(component, SchedulerItem::INTERVAL, nullptr, false, id, true, interval, std::move(func));
+}
+bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
+  return this->cancel_item_(component, fnv1_hash(name), name.c_str(), SchedulerItem::INTERVAL);
+}
+bool HOT Scheduler::cancel_interval_static_(Component *component, const char *name) {
+  return this->cancel_item_(component, hash_name(name), name, SchedulerItem::INTERVAL);
+}
+bool HOT Scheduler::cancel_interval(Component *component, uint32_t id) {
+  return this->cancel_item_(component, id, nullptr, SchedulerItem::INTERVAL);
+}
+Scheduler::TimerHandle HOT Scheduler::arm_timeout(Component *component, uint32_t timeout,
+                                                   std::function<void()> func) {
+  return this->set_timer_(component, SchedulerItem::TIMEOUT, nullptr, false, hash_name(nullptr), false, timeout,
+                          std::move(func));
+}
+Scheduler::TimerHandle HOT Scheduler::arm_interval(Component *component, uint32_t interval,
+                                                    std::function<void()> func) {
+  return this->set_timer_(component, SchedulerItem::INTERVAL, nullptr, false, hash_name(nullptr), false, interval,
+                          std::move(func));
+}
+bool HOT Scheduler::cancel(TimerHandle handle) {
+  LockGuard guard{this->lock_};
+  if (handle.index >= this->slots_.size())
+    return false;
+  const TimerSlot &slot = this->slots_[handle.index];
+  if (slot.generation != handle.generation || slot.item == nullptr || slot.item->remove)
+    return false;
+  slot.item->remove = true;
+  if (slot.item->in_heap)
+    this->to_remove_++;
+  return true;
+}
+Scheduler::TimerHandle HOT Scheduler::set_timer_(Component *component, SchedulerItem::Type type, const char *name,
+                                                 bool name_is_static, uint32_t name_hash, bool named, uint32_t delay,
+                                                 std::function<void()> func) {
   const uint32_t now = this->millis_();
 
-  if (!name.empty())
-    this->cancel_interval(component, name);
-
-  if (interval == SCHEDULER_DONT_RUN)
-    return;
-
-  // only put offset in lower half
-  uint32_t offset = 0;
-  if (interval != 0)
-    offset = (random_uint32() % interval) / 2;
+  if (named)
+    this->cancel_item_(component, name_hash, name, type);
 
-  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
+  if (delay == SCHEDULER_DONT_RUN)
+    return {};
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->get_item_();
   item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::INTERVAL;
-  item->interval = interval;
-  item->last_execution = now - offset - interval;
+  if (name_is_static) {
+    item->name = name;
+    item->name_str.clear();
+  } else {
+    // Assigning keeps the capacity of a pooled item, so this rarely allocates
+    item->name = nullptr;
+    if (name != nullptr) {
+      item->name_str = name;
+    } else {
+      item->name_str.clear();
+    }
+  }
+  item->name_hash = name_hash;
+  item->type = type;
+  item->interval = delay;
+  item->last_execution = now;
   item->last_execution_major = this->millis_major_;
-  if (item->last_execution > now)
-    item->last_execution_major--;
+
+  if (type == SchedulerItem::INTERVAL) {
+    // only put offset in lower half
+    uint32_t offset = 0;
+    if (delay != 0)
+      offset = (random_uint32() % delay) / 2;
+    item->last_execution = now - offset - delay;
+    if (item->last_execution > now)
+      item->last_execution_major--;
+    ESP_LOGVV(TAG, "set_interval(name='%s', id=0x%08" PRIx32 ", interval=%" PRIu32 ", offset=%" PRIu32 ")",
+              item->get_name(), name_hash, delay, offset);
+  } else {
+    ESP_LOGVV(TAG, "set_%s(name='%s', id=0x%08" PRIx32 ", timeout=%" PRIu32 ")", item->get_type_str(),
+              item->get_name(), name_hash, delay);
+  }
+
   item->callback = std::move(func);
   item->remove = false;
-  this->push_(std::move(item));
-}
-bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+  item->in_heap = false;
+  return this->push_(std::move(item));
 }
 
 struct RetryArgs {
@@ -84,17 +149,23 @@ struct RetryArgs {
   uint8_t retry_countdown;
   uint32_t current_interval;
   Component *component;
-  std::string name;
+  // `name` points to a string literal, names passed as std::string are kept in `name_str`
+  const char *name;
+  std::string name_str;
+  uint32_t name_hash;
   float backoff_increase_factor;
   Scheduler *scheduler;
+
+  const char *get_name() const { return this->name != nullptr ? this->name : this->name_str.c_str(); }
 };
 
-static void retry_handler(const std::shared_ptr<RetryArgs> &args) {
+void Scheduler::retry_handler_(const std::shared_ptr<RetryArgs> &args) {
   RetryResult const retry_result = args->func(--args->retry_countdown);
   if (retry_result == RetryResult::DONE || args->retry_countdown <= 0)
     return;
   // second execution of `func` happens after `initial_wait_time`
-  args->scheduler->set_timeout(args->component, args->name, args->current_interval, [args]() { retry_handler(args); });
+  args->scheduler->set_timer_(args->component, SchedulerItem::RETRY, args->get_name(), args->name != nullptr,
+                              args->name_hash, true, args->current_interval, [args]() { retry_handler_(args); });
   // backoff_increase_factor applied to third & later executions
   args->current_interval *= args->backoff_increase_factor;
 }
@@ -102,19 +173,31 @@ static void retry_handler(const std::shared_ptr<RetryArgs> &args) {
 void HOT Scheduler::set_retry(Component *component, const std::string &name, uint32_t initial_wait_time,
                               uint8_t max_attempts, std::function<RetryResult(uint8_t)> func,
                               float backoff_increase_factor) {
-  if (!name.empty())
-    this->cancel_retry(component, name);
+  this->set_retry_(component, name.c_str(), false, fnv1_hash(name), initial_wait_time, max_attempts, std::move(func),
+                   backoff_increase_factor);
+}
+void HOT Scheduler::set_retry_static_(Component *component, const char *name, uint32_t initial_wait_time,
+                                      uint8_t max_attempts, std::function<RetryResult(uint8_t)> func,
+                                      float backoff_increase_factor) {
+  this->set_retry_(component, name, true, hash_name(name), initial_wait_time, max_attempts, std::move(func),
+                   backoff_increase_factor);
+}
+void HOT Scheduler::set_retry_(Component *component, const char *name, bool name_is_static, uint32_t name_hash,
+                               uint32_t initial_wait_time, uint8_t max_attempts,
+                               std::function<RetryResult(uint8_t)> func, float backoff_increase_factor) {
+  // Retries are always named, so like before a new anonymous retry replaces the pending one of the same component
+  this->cancel_item_(component, name_hash, name, SchedulerItem::RETRY);
 
   if (initial_wait_time == SCHEDULER_DONT_RUN)
     return;
 
-  ESP_LOGVV(TAG, "set_retry(name='%s', initial_wait_time=%" PRIu32 ", max_attempts=%u, backoff_factor=%0.1f)",
-            name.c_str(), initial_wait_time, max_attempts, backoff_increase_factor);
+  ESP_LOGVV(TAG, "set_retry(name='%s', initial_wait_time=%" PRIu32 ", max_attempts=%u, backoff_factor=%0.1f)", name,
+            initial_wait_time, max_attempts, backoff_increase_factor);
 
   if (backoff_increase_factor < 0.0001) {
     ESP_LOGE(TAG,
              "set_retry(name='%s'): backoff_factor cannot be close to zero nor negative (%0.1f). Using 1.0 instead",
-             name.c_str(), backoff_increase_factor);
+             name, backoff_increase_factor);
     backoff_increase_factor = 1;
   }
 
@@ -123,15 +206,26 @@ void HOT Scheduler::set_retry(Component *component, const std::string &name, uin
   args->retry_countdown = max_attempts;
   args->current_interval = initial_wait_time;
   args->component = component;
-  args->name = "retry$" + name;
+  // Names passed as std::string may not outlive this call, so those are copied
+  if (name_is_static) {
+    args->name = name;
+  } else {
+    args->name = nullptr;
+    args->name_str = name;
+  }
+  args->name_hash = name_hash;
   args->backoff_increase_factor = backoff_increase_factor;
   args->scheduler = this;
 
   // First execution of `func` immediately
-  this->set_timeout(component, args->name, 0, [args]() { retry_handler(args); });
+  this->set_timer_(component, SchedulerItem::RETRY, args->get_name(), name_is_static, name_hash, true, 0,
+                   [args]() { retry_handler_(args); });
 }
 bool HOT Scheduler::cancel_retry(Component *component, const std::string &name) {
-  return this->cancel_timeout(component, "retry$" + name);
+  return this->cancel_item_(component, fnv1_hash(name), name.c_str(), SchedulerItem::RETRY);
+}
+bool HOT Scheduler::cancel_retry_static_(Component *component, const char *name) {
+  return this->cancel_item_(component, hash_name(name), name, SchedulerItem::RETRY);
 }
 
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
@@ -162,7 +256,7 @@ void HOT Scheduler::call() {
       this->lock_.unlock();
 
       ESP_LOGVV(TAG, "  %s '%s' interval=%" PRIu32 " last_execution=%" PRIu32 " (%u) next=%" PRIu32 " (%u)",
-                item->get_type_str(), item->name.c_str(), item->interval, item->last_execution,
+                item->get_type_str(), item->get_name(), item->interval, item->last_execution,
                 item->last_execution_major, item->next_execution(), item->next_execution_major());
 
       old_items.push_back(std::move(item));
@@ -176,30 +270,9 @@ void HOT Scheduler::call() {
   }
 #endif  // ESPHOME_DEBUG_SCHEDULER
 
-  auto to_remove_was = to_remove_;
-  auto items_was = this->items_.size();
   // If we have too many items to remove
-  if (to_remove_ > MAX_LOGICALLY_DELETED_ITEMS) {
-    std::vector<std::unique_ptr<SchedulerItem>> valid_items;
-    while (!this->empty_()) {
-      LockGuard guard{this->lock_};
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      valid_items.push_back(std::move(item));
-    }
-
-    {
-      LockGuard guard{this->lock_};
-      this->items_ = std::move(valid_items);
-    }
-
-    // The following should not happen unless I'm missing something
-    if (to_remove_ != 0) {
-      ESP_LOGW(TAG, "to_remove_ was %" PRIu32 " now: %" PRIu32 " items where %zu now %zu. Please report this",
-               to_remove_was, to_remove_, items_was, items_.size());
-      to_remove_ = 0;
-    }
-  }
+  if (this->to_remove_ > MAX_LOGICALLY_DELETED_ITEMS)
+    this->compact_();
 
   while (!this->empty_()) {
     // use scoping to indicate visibility of `item` variable
@@ -223,7 +296,7 @@ void HOT Scheduler::call() {
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
       ESP_LOGVV(TAG, "Running %s '%s' with interval=%" PRIu32 " last_execution=%" PRIu32 " (now=%" PRIu32 ")",
-                item->get_type_str(), item->name.c_str(), item->interval, item->last_execution, now);
+                item->get_type_str(), item->get_name(), item->interval, item->last_execution, now);
 #endif
 
       // Warning: During callback(), a lot of stuff can happen, including:
@@ -231,12 +304,24 @@ void HOT Scheduler::call() {
       //  - timeouts/intervals get cancelled
       {
         WarnIfComponentBlockingGuard guard{item->component};
+#ifdef USE_PROFILER
+        // Copy the identity out, `item` may have moved after the callback. The item itself (and so its name) stays
+        // alive until release_items_() at the end of this call.
+        Component *component = item->component;
+        const char *type = item->get_type_str();
+        const char *name = item->get_name();
+        const uint32_t name_hash = item->name_hash;
+        const uint32_t start = micros();
         item->callback();
+        App.profiler.record_scheduler(component, type, name, name_hash, micros() - start);
+#else
+        item->callback();
+#endif
       }
     }
 
     {
-      this->lock_.lock();
+      LockGuard guard{this->lock_};
 
       // new scope, item from before might have been moved in the vector
       auto item = std::move(this->items_[0]);
@@ -244,12 +329,12 @@ void HOT Scheduler::call() {
       // Only pop after function call, this ensures we were reachable
       // during the function call and know if we were cancelled.
       this->pop_raw_();
-
-      this->lock_.unlock();
+      item->in_heap = false;
 
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         to_remove_--;
+        this->recycle_item_(std::move(item));
         continue;
       }
 
@@ -261,20 +346,25 @@ void HOT Scheduler::call() {
           if (item->last_execution < before)
             item->last_execution_major++;
         }
-        this->push_(std::move(item));
+        this->to_add_.push_back(std::move(item));
+      } else {
+        this->recycle_item_(std::move(item));
       }
     }
   }
 
   this->process_to_add();
+  this->release_items_();
 }
 void HOT Scheduler::process_to_add() {
   LockGuard guard{this->lock_};
   for (auto &it : this->to_add_) {
     if (it->remove) {
+      this->recycle_item_(std::move(it));
       continue;
     }
 
+    it->in_heap = true;
     this->items_.push_back(std::move(it));
     std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
   }
@@ -294,27 +384,108 @@ void HOT Scheduler::cleanup_() {
     }
   }
 }
+void HOT Scheduler::compact_() {
+  LockGuard guard{this->lock_};
+  // Drop all cancelled items in a single pass and restore the heap property afterwards, instead of popping every item
+  // off the heap one by one.
+  auto first_removed = std::partition(this->items_.begin(), this->items_.end(),
+                                      [](const std::unique_ptr<SchedulerItem> &item) { return !item->remove; });
+  for (auto it = first_removed; it != this->items_.end(); ++it)
+    this->recycle_item_(std::move(*it));
+  this->items_.erase(first_removed, this->items_.end());
+  std::make_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+  this->to_remove_ = 0;
+}
 void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+  // The caller may have already moved the item out of the heap
+  if (this->items_.back() != nullptr)
+    this->recycle_item_(std::move(this->items_.back()));
   this->items_.pop_back();
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
-  LockGuard guard{this->lock_};
-  this->to_add_.push_back(std::move(item));
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::get_item_() {
+  {
+    LockGuard guard{this->lock_};
+    if (!this->item_pool_.empty()) {
+      auto item = std::move(this->item_pool_.back());
+      this->item_pool_.pop_back();
+      return item;
+    }
+  }
+  return make_unique<SchedulerItem>();
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  // Handles to the item go stale here, before it can be reused for another timer
+  TimerSlot &slot = this->slots_[item->slot];
+  slot.item = nullptr;
+  slot.generation++;
+  this->free_slots_.push_back(item->slot);
+  // The callback is released by release_items_() once the lock is dropped, destroying its captures here could
+  // deadlock when one of them calls back into the scheduler.
+  this->released_.push_back(std::move(item));
+}
+void HOT Scheduler::release_items_() {
+  {
+    LockGuard guard{this->lock_};
+    if (this->released_.empty())
+      return;
+    std::swap(this->released_, this->releasing_);
+  }
+  // Release whatever the callbacks captured now rather than when the items are reused
+  for (auto &item : this->releasing_)
+    item->callback = nullptr;
+  {
+    LockGuard guard{this->lock_};
+    for (auto &item : this->releasing_) {
+      if (this->item_pool_.size() >= MAX_POOL_SIZE)
+        break;
+      this->item_pool_.push_back(std::move(item));
+    }
+  }
+  // Items that did not fit into the pool are freed here, outside of the lock as well
+  this->releasing_.clear();
+}
+Scheduler::TimerHandle HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
+  TimerHandle handle;
+  {
+    LockGuard guard{this->lock_};
+    if (this->free_slots_.empty()) {
+      handle.index = this->slots_.size();
+      this->slots_.push_back(TimerSlot{item.get(), 0});
+    } else {
+      handle.index = this->free_slots_.back();
+      this->free_slots_.pop_back();
+      this->slots_[handle.index].item = item.get();
+    }
+    handle.generation = this->slots_[handle.index].generation;
+    item->slot = handle.index;
+    this->to_add_.push_back(std::move(item));
+  }
+  // Timers may be set from other tasks while the main loop is sleeping
+  App.wake_loop_any_context();
+  return handle;
 }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
+bool HOT Scheduler::cancel_item_(Component *component, uint32_t name_hash, const char *name,
+                                 Scheduler::SchedulerItem::Type type) {
+  // Cancelling by name is a linear scan over both containers, timers that are re-armed very often can use
+  // arm_timeout() and cancel() instead.
   // obtain lock because this function iterates and can be called from non-loop task context
   LockGuard guard{this->lock_};
+  // A hash collision must not cancel an unrelated timer, so compare the names as well when both sides have one
+  auto matches = [=](const std::unique_ptr<SchedulerItem> &it) {
+    return it->component == component && it->name_hash == name_hash && it->type == type &&
+           (name == nullptr || !it->has_name() || strcmp(it->get_name(), name) == 0);
+  };
   bool ret = false;
   for (auto &it : this->items_) {
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
+    if (!it->remove && matches(it)) {
       to_remove_++;
       it->remove = true;
       ret = true;
     }
   }
   for (auto &it : this->to_add_) {
-    if (it->component == component && it->name == name && it->type == type) {
+    if (matches(it)) {
       it->remove = true;
       ret = true;
     }
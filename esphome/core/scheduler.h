@@ -9,17 +9,73 @@
 namespace esphome {
 
 class Component;
+struct RetryArgs;
 
 class Scheduler {
+  // Component forwards its string literal names to the non-template *_static_ methods below
+  friend class Component;
+
  public:
+  // Timers are identified by (component, name, type). Items are looked up by the FNV-1 hash of their name, and the
+  // names themselves are compared on a hash match whenever both sides have one. Timers set with a std::string name can
+  // be cancelled through the string literal or id overloads and vice versa.
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
+  /** Set a timeout named by a string literal, without building a std::string.
+   *
+   * Only arrays bind to this overload since the name is kept by pointer, any other `const char *` goes through the
+   * std::string overload and is copied.
+   */
+  template<size_t N>
+  void set_timeout(Component *component, const char (&name)[N], uint32_t timeout, std::function<void()> func) {
+    this->set_timeout_static_(component, name, timeout, std::move(func));
+  }
+  /// Set a timeout identified by \p id, e.g. a name hashed at compile time with fnv1_hash().
+  void set_timeout(Component *component, uint32_t id, uint32_t timeout, std::function<void()> func);
   bool cancel_timeout(Component *component, const std::string &name);
+  template<size_t N> bool cancel_timeout(Component *component, const char (&name)[N]) {
+    return this->cancel_timeout_static_(component, name);
+  }
+  bool cancel_timeout(Component *component, uint32_t id);
   void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> func);
+  template<size_t N>
+  void set_interval(Component *component, const char (&name)[N], uint32_t interval, std::function<void()> func) {
+    this->set_interval_static_(component, name, interval, std::move(func));
+  }
+  void set_interval(Component *component, uint32_t id, uint32_t interval, std::function<void()> func);
   bool cancel_interval(Component *component, const std::string &name);
+  template<size_t N> bool cancel_interval(Component *component, const char (&name)[N]) {
+    return this->cancel_interval_static_(component, name);
+  }
+  bool cancel_interval(Component *component, uint32_t id);
 
   void set_retry(Component *component, const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,
                  std::function<RetryResult(uint8_t)> func, float backoff_increase_factor = 1.0f);
+  template<size_t N>
+  void set_retry(Component *component, const char (&name)[N], uint32_t initial_wait_time, uint8_t max_attempts,
+                 std::function<RetryResult(uint8_t)> func, float backoff_increase_factor = 1.0f) {
+    this->set_retry_static_(component, name, initial_wait_time, max_attempts, std::move(func),
+                            backoff_increase_factor);
+  }
   bool cancel_retry(Component *component, const std::string &name);
+  template<size_t N> bool cancel_retry(Component *component, const char (&name)[N]) {
+    return this->cancel_retry_static_(component, name);
+  }
+
+  /// Refers to a timer set with arm_timeout() or arm_interval(). It goes stale once the timer is done or cancelled,
+  /// so a handle can be kept and cancelled later without checking whether the timer already ran.
+  struct TimerHandle {
+    uint32_t index{UINT32_MAX};
+    uint32_t generation{0};
+  };
+  /** Set an anonymous timeout and return a handle to cancel it with.
+   *
+   * Unlike named timers, arming does not replace an earlier timer and cancelling does not look anything up, both are
+   * O(1). Meant for timers that are re-armed very often, e.g. debounce filters.
+   */
+  TimerHandle arm_timeout(Component *component, uint32_t timeout, std::function<void()> func);
+  TimerHandle arm_interval(Component *component, uint32_t interval, std::function<void()> func);
+  /// Cancel the timer of \p handle. Returns false if it already ran (timeouts) or was cancelled before.
+  bool cancel(TimerHandle handle);
 
   optional<uint32_t> next_schedule_in();
 
@@ -30,15 +86,23 @@ class Scheduler {
  protected:
   struct SchedulerItem {
     Component *component;
-    std::string name;
-    enum Type { TIMEOUT, INTERVAL } type;
+    // Points to the name if it was passed as a string literal, std::string names are copied into `name_str` instead
+    // (which keeps its capacity while the item is pooled). Items set by id have neither.
+    const char *name;
+    std::string name_str;
+    uint32_t name_hash;
+    enum Type { TIMEOUT, INTERVAL, RETRY } type;
     union {
       uint32_t interval;
       uint32_t timeout;
     };
     uint32_t last_execution;
     std::function<void()> callback;
+    // Index of the item in `slots_`, for cancelling by handle
+    uint32_t slot;
     bool remove;
+    // Whether the item is in `items_` rather than in `to_add_`
+    bool in_heap;
     uint8_t last_execution_major;
 
     inline uint32_t next_execution() { return this->last_execution + this->timeout; }
@@ -57,17 +121,44 @@ class Scheduler {
           return "interval";
         case SchedulerItem::TIMEOUT:
           return "timeout";
+        case SchedulerItem::RETRY:
+          return "retry";
         default:
           return "";
       }
     }
+    const char *get_name() const { return this->name != nullptr ? this->name : this->name_str.c_str(); }
+    bool has_name() const { return this->name != nullptr || !this->name_str.empty(); }
   };
 
+  void set_timeout_static_(Component *component, const char *name, uint32_t timeout, std::function<void()> func);
+  bool cancel_timeout_static_(Component *component, const char *name);
+  void set_interval_static_(Component *component, const char *name, uint32_t interval, std::function<void()> func);
+  bool cancel_interval_static_(Component *component, const char *name);
+  void set_retry_static_(Component *component, const char *name, uint32_t initial_wait_time, uint8_t max_attempts,
+                         std::function<RetryResult(uint8_t)> func, float backoff_increase_factor);
+  bool cancel_retry_static_(Component *component, const char *name);
+
+  // \p name is stored by pointer if \p name_is_static, copied otherwise, and may be null for items set by id.
+  TimerHandle set_timer_(Component *component, SchedulerItem::Type type, const char *name, bool name_is_static,
+                  uint32_t name_hash, bool named, uint32_t delay, std::function<void()> func);
+  void set_retry_(Component *component, const char *name, bool name_is_static, uint32_t name_hash,
+                  uint32_t initial_wait_time, uint8_t max_attempts, std::function<RetryResult(uint8_t)> func,
+                  float backoff_increase_factor);
+  static void retry_handler_(const std::shared_ptr<RetryArgs> &args);
   uint32_t millis_();
   void cleanup_();
+  void compact_();
   void pop_raw_();
-  void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
+  TimerHandle push_(std::unique_ptr<SchedulerItem> item);
+  // Take an item from the pool (or allocate one if the pool is empty)
+  std::unique_ptr<SchedulerItem> get_item_();
+  // Return an item to the pool. Must be called with `lock_` held, the item only reaches the pool in release_items_().
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
+  // Release the callbacks of recycled items without holding `lock_` and move the items into the pool.
+  void release_items_();
+  // Cancel the items of \p component with the given hash, if \p name is given only those with the same name.
+  bool cancel_item_(Component *component, uint32_t name_hash, const char *name, SchedulerItem::Type type);
   bool empty_() {
     this->cleanup_();
     return this->items_.empty();
@@ -76,6 +167,19 @@ class Scheduler {
   Mutex lock_;
   std::vector<std::unique_ptr<SchedulerItem>> items_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  // Finished and cancelled items are kept here for reuse, so that re-arming a timeout does not hit the heap.
+  std::vector<std::unique_ptr<SchedulerItem>> item_pool_;
+  // Recycled items whose callbacks still have to be released, and the buffer release_items_() swaps them into
+  std::vector<std::unique_ptr<SchedulerItem>> released_;
+  std::vector<std::unique_ptr<SchedulerItem>> releasing_;
+  // Every live item has a slot. The generation of a slot changes whenever its item is recycled, which is what makes
+  // older handles to it stale.
+  struct TimerSlot {
+    SchedulerItem *item;
+    uint32_t generation;
+  };
+  std::vector<TimerSlot> slots_;
+  std::vector<uint32_t> free_slots_;
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};
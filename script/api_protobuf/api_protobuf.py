@@ -52,6 +52,14 @@ def indent(text, padding="  "):
     return "\n".join(indent_list(text, padding))
 
 
+def varint_size(value):
+    size = 1
+    while value >= 0x80:
+        value >>= 7
+        size += 1
+    return size
+
+
 def camel_to_snake(name):
     # https://stackoverflow.com/a/1176023
     s1 = re.sub("(.)([A-Z][a-z]+)", r"\1_\2", name)
@@ -176,6 +184,22 @@ class TypeInfo(ABC):
 
     encode_func = None
 
+    # Protobuf wire type used in the field tag, 0 = varint, 2 = length delimited, 5 = 32-bit
+    wire_type = 0
+    size_func = None
+
+    @property
+    def field_id_size(self):
+        return varint_size((self.number << 3) | self.wire_type)
+
+    def get_size_calculation(self, name, force=False):
+        force_arg = ", true" if force else ""
+        return f"ProtoSize::{self.size_func}(total_size, {self.field_id_size}, {name}{force_arg});"
+
+    @property
+    def size_content(self):
+        return self.get_size_calculation(f"this->{self.field_name}")
+
     @property
     def dump_content(self):
         o = f'out.append("  {self.name}: ");\n'
@@ -205,6 +229,8 @@ class DoubleType(TypeInfo):
     default_value = "0.0"
     decode_64bit = "value.as_double()"
     encode_func = "encode_double"
+    size_func = "add_double_field"
+    wire_type = 1
 
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
@@ -218,6 +244,8 @@ class FloatType(TypeInfo):
     default_value = "0.0f"
     decode_32bit = "value.as_float()"
     encode_func = "encode_float"
+    size_func = "add_float_field"
+    wire_type = 5
 
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
@@ -231,6 +259,7 @@ class Int64Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_int64()"
     encode_func = "encode_int64"
+    size_func = "add_int64_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%lld", {name});\n'
@@ -244,6 +273,7 @@ class UInt64Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_uint64()"
     encode_func = "encode_uint64"
+    size_func = "add_uint64_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%llu", {name});\n'
@@ -257,6 +287,7 @@ class Int32Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_int32()"
     encode_func = "encode_int32"
+    size_func = "add_int32_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRId32, {name});\n'
@@ -270,6 +301,8 @@ class Fixed64Type(TypeInfo):
     default_value = "0"
     decode_64bit = "value.as_fixed64()"
     encode_func = "encode_fixed64"
+    size_func = "add_fixed64_field"
+    wire_type = 1
 
     def dump(self, name):
         o = f'sprintf(buffer, "%llu", {name});\n'
@@ -283,6 +316,8 @@ class Fixed32Type(TypeInfo):
     default_value = "0"
     decode_32bit = "value.as_fixed32()"
     encode_func = "encode_fixed32"
+    size_func = "add_fixed32_field"
+    wire_type = 5
 
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRIu32, {name});\n'
@@ -296,6 +331,7 @@ class BoolType(TypeInfo):
     default_value = "false"
     decode_varint = "value.as_bool()"
     encode_func = "encode_bool"
+    size_func = "add_bool_field"
 
     def dump(self, name):
         o = f"out.append(YESNO({name}));"
@@ -310,6 +346,8 @@ class StringType(TypeInfo):
     const_reference_type = "const std::string &"
     decode_length = "value.as_string()"
     encode_func = "encode_string"
+    size_func = "add_string_field"
+    wire_type = 2
 
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
@@ -336,9 +374,23 @@ class MessageType(TypeInfo):
     def encode_func(self):
         return f"encode_message<{self.cpp_type}>"
 
+    wire_type = 2
+    size_func = "add_message_object"
+
+    def get_size_calculation(self, name, force=False):
+        # nested messages are always encoded, force makes no difference
+        return f"ProtoSize::{self.size_func}(total_size, {self.field_id_size}, {name});"
+
     @property
-    def decode_length(self):
-        return f"value.as_message<{self.cpp_type}>()"
+    def decode_length_content(self) -> str:
+        # decode straight into the member instead of going through a temporary
+        return dedent(
+            f"""\
+        case {self.number}: {{
+          value.decode_to_message(this->{self.field_name});
+          return true;
+        }}"""
+        )
 
     def dump(self, name):
         o = f"{name}.dump_to(out);"
@@ -353,18 +405,43 @@ class BytesType(TypeInfo):
     const_reference_type = "const std::string &"
     decode_length = "value.as_string()"
     encode_func = "encode_string"
+    size_func = "add_string_field"
+    wire_type = 2
 
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
         return o
 
 
+class StringRefType(TypeInfo):
+    """A string the message only points to, the owner has to keep it alive until the message is encoded."""
+
+    cpp_type = "StringRef"
+    default_value = ""
+    reference_type = "StringRef &"
+    const_reference_type = "const StringRef &"
+    encode_func = "encode_string"
+    size_func = "add_string_field"
+    wire_type = 2
+
+    def dump(self, name):
+        o = f'out.append("\'").append({name}.c_str(), {name}.size()).append("\'");'
+        return o
+
+
+class BytesViewType(StringRefType):
+    """Bytes pointing into the receive buffer, only valid while the message is being handled."""
+
+    decode_length = "value.as_string_ref()"
+
+
 @register_type(13)
 class UInt32Type(TypeInfo):
     cpp_type = "uint32_t"
     default_value = "0"
     decode_varint = "value.as_uint32()"
     encode_func = "encode_uint32"
+    size_func = "add_uint32_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRIu32, {name});\n'
@@ -388,6 +465,10 @@ class EnumType(TypeInfo):
     def encode_func(self):
         return f"encode_enum<{self.cpp_type}>"
 
+    @property
+    def size_func(self):
+        return f"add_enum_field<{self.cpp_type}>"
+
     def dump(self, name):
         o = f"out.append(proto_enum_to_string<{self.cpp_type}>({name}));"
         return o
@@ -399,6 +480,8 @@ class SFixed32Type(TypeInfo):
     default_value = "0"
     decode_32bit = "value.as_sfixed32()"
     encode_func = "encode_sfixed32"
+    size_func = "add_sfixed32_field"
+    wire_type = 5
 
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRId32, {name});\n'
@@ -412,6 +495,8 @@ class SFixed64Type(TypeInfo):
     default_value = "0"
     decode_64bit = "value.as_sfixed64()"
     encode_func = "encode_sfixed64"
+    size_func = "add_sfixed64_field"
+    wire_type = 1
 
     def dump(self, name):
         o = f'sprintf(buffer, "%lld", {name});\n'
@@ -425,6 +510,7 @@ class SInt32Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_sint32()"
     encode_func = "encode_sint32"
+    size_func = "add_sint32_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRId32, {name});\n'
@@ -438,6 +524,7 @@ class SInt64Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_sint64()"
     encode_func = "encode_sint64"
+    size_func = "add_sint64_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%lld", {name});\n'
@@ -477,6 +564,14 @@ class RepeatedTypeInfo(TypeInfo):
 
     @property
     def decode_length_content(self) -> str:
+        if isinstance(self._ti, MessageType):
+            return dedent(
+                f"""\
+            case {self.number}: {{
+              value.decode_to_message(this->{self.field_name}.emplace_back());
+              return true;
+            }}"""
+            )
         content = self._ti.decode_length
         if content is None:
             return None
@@ -526,6 +621,13 @@ class RepeatedTypeInfo(TypeInfo):
         o += "}"
         return o
 
+    @property
+    def size_content(self):
+        o = f"for (const auto {'' if self._ti_is_bool else '&'}it : this->{self.field_name}) {{\n"
+        o += f"  {self._ti.get_size_calculation('it', True)}\n"
+        o += "}"
+        return o
+
     @property
     def dump_content(self):
         o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
@@ -561,6 +663,28 @@ def build_enum_type(desc):
     return out, cpp
 
 
+def uses_string_ref(desc, field):
+    # Entity descriptions are only ever sent by the device, their strings are owned by the entity
+    # so the message can point at them instead of holding a copy.
+    return (
+        field.type == 9
+        and field.label != 3
+        and desc.name.startswith("ListEntities")
+        and get_opt(desc, pb.source, SOURCE_BOTH) == SOURCE_SERVER
+    )
+
+
+def uses_bytes_view(desc, field):
+    # Payloads received from the client (GATT writes, audio) are handled before the receive buffer is
+    # reused, so they can point into it instead of being copied. Nested messages without a source are
+    # also built by the device and keep owning their bytes.
+    return (
+        field.type == 12
+        and field.label != 3
+        and get_opt(desc, pb.source, SOURCE_SERVER) != SOURCE_SERVER
+    )
+
+
 def build_message_type(desc):
     public_content = []
     protected_content = []
@@ -569,16 +693,22 @@ def build_message_type(desc):
     decode_32bit = []
     decode_64bit = []
     encode = []
+    size = []
     dump = []
 
     for field in desc.field:
         if field.label == 3:
             ti = RepeatedTypeInfo(field)
+        elif uses_string_ref(desc, field):
+            ti = StringRefType(field)
+        elif uses_bytes_view(desc, field):
+            ti = BytesViewType(field)
         else:
             ti = TYPE_INFO[field.type](field)
         protected_content.extend(ti.protected_content)
         public_content.extend(ti.public_content)
         encode.append(ti.encode_content)
+        size.append(ti.size_content)
 
         if ti.decode_varint_content:
             decode_varint.append(ti.decode_varint_content)
@@ -645,6 +775,18 @@ def build_message_type(desc):
     prot = "void encode(ProtoWriteBuffer buffer) const override;"
     public_content.append(prot)
 
+    o = f"void {desc.name}::calculate_size(uint32_t &total_size) const {{"
+    if size:
+        if len(size) == 1 and len(size[0]) + len(o) + 3 < 120:
+            o += f" {size[0]} "
+        else:
+            o += "\n"
+            o += indent("\n".join(size)) + "\n"
+    o += "}\n"
+    cpp += o
+    prot = "void calculate_size(uint32_t &total_size) const override;"
+    public_content.append(prot)
+
     o = f"void {desc.name}::dump_to(std::string &out) const {{"
     if dump:
         if len(dump) == 1 and len(dump[0]) + len(o) + 3 < 120:
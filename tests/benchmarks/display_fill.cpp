@@ -0,0 +1,37 @@
+// Time to fill shapes into a 320x480 RGB565 frame buffer.
+//
+// components: display
+
+#include "rgb565_display.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace esphome;
+
+namespace {
+
+const int FRAMES = 200;
+
+template<typename F> void measure(const char *what, F &&draw_frame) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < FRAMES; frame++)
+    draw_frame(frame);
+  const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  printf("%-32s %8.3f ms/frame\n", what, ms / FRAMES);
+}
+
+}  // namespace
+
+void setup() {
+  benchmark::RGB565Display display(320, 480);
+  measure("filled_rectangle full screen",
+          [&](int frame) { display.filled_rectangle(0, 0, 320, 480, Color(frame, 255 - frame, frame * 3)); });
+  measure("20 concentric filled circles", [&](int frame) {
+    for (int i = 0; i < 20; i++)
+      display.filled_circle(160, 240, 10 + i * 7, Color(i * 10, frame, 0));
+  });
+  exit(0);
+}
+
+void loop() {}
@@ -0,0 +1,70 @@
+// Time to measure and print a short string with an antialiased font into a 320x480 RGB565 frame buffer.
+//
+// components: display font
+// defines: USE_DISPLAY
+
+#include "rgb565_display.h"
+#include "esphome/components/font/font.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace esphome;
+
+namespace {
+
+const int ROUNDS = 20000;
+const int GLYPH_WIDTH = 10;
+const int GLYPH_HEIGHT = 16;
+const char *const TEXT = "Temperature 21.5 C";
+
+template<typename F> void measure(const char *what, F &&run) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < ROUNDS; r++)
+    run();
+  const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  printf("%-32s %8.3f us/op\n", what, us / ROUNDS);
+}
+
+}  // namespace
+
+void setup() {
+  benchmark::RGB565Display display(320, 480);
+  uint32_t seed = 12345;
+  auto random_byte = [&seed]() {
+    seed = seed * 1103515245 + 12345;
+    return uint8_t(seed >> 16);
+  };
+
+  // Printable ASCII at 8 bits per pixel. Each glyph row is a stroke with an antialiased pixel on either side, like a
+  // rendered font.
+  static uint8_t chars[0x7F - 0x20][2];
+  std::vector<std::vector<uint8_t>> bitmaps;
+  std::vector<font::GlyphData> glyphs;
+  for (int c = 0x20; c < 0x7F; c++) {
+    chars[c - 0x20][0] = c;
+    chars[c - 0x20][1] = 0;
+    std::vector<uint8_t> bitmap(GLYPH_WIDTH * GLYPH_HEIGHT);
+    for (int y = 0; y < GLYPH_HEIGHT; y++) {
+      uint8_t *row = &bitmap[y * GLYPH_WIDTH];
+      const int start = 1 + random_byte() % (GLYPH_WIDTH - 3);
+      const int end = start + 1 + random_byte() % (GLYPH_WIDTH - 2 - start);
+      row[start - 1] = random_byte();
+      for (int x = start; x < end; x++)
+        row[x] = 0xFF;
+      row[end] = random_byte();
+    }
+    bitmaps.push_back(std::move(bitmap));
+  }
+  for (size_t i = 0; i < bitmaps.size(); i++)
+    glyphs.push_back(font::GlyphData{chars[i], bitmaps[i].data(), 0, 2, GLYPH_WIDTH, GLYPH_HEIGHT});
+  font::Font font(glyphs.data(), glyphs.size(), 16, 20, 8);
+
+  int width, x_offset, baseline, height;
+  measure("measure 18 characters", [&]() { font.measure(TEXT, &width, &x_offset, &baseline, &height); });
+  measure("print 18 characters", [&]() { font.print(10, 10, &display, Color(255, 255, 255), TEXT, Color(0, 0, 0)); });
+  exit(0);
+}
+
+void loop() {}
@@ -0,0 +1,51 @@
+// Time to draw a full screen image into a 320x480 RGB565 frame buffer.
+//
+// components: display image
+
+#include "rgb565_display.h"
+#include "esphome/components/image/image.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace esphome;
+
+namespace {
+
+const int DRAWS = 50;
+
+void measure(const char *what, image::Image &image, display::Display &display) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < DRAWS; i++)
+    image.draw(0, 0, &display, Color(255, 255, 255, 255), Color(0, 0, 0, 255));
+  const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  printf("%-32s %8.3f ms/draw\n", what, ms / DRAWS);
+}
+
+}  // namespace
+
+void setup() {
+  benchmark::RGB565Display display(320, 480);
+  uint32_t seed = 12345;
+  auto random_byte = [&seed]() {
+    seed = seed * 1103515245 + 12345;
+    return uint8_t(seed >> 16);
+  };
+
+  std::vector<uint8_t> rgb565(320 * 480 * 2);
+  for (auto &byte : rgb565)
+    byte = random_byte();
+  image::Image rgb565_image(rgb565.data(), 320, 480, image::IMAGE_TYPE_RGB565, image::TRANSPARENCY_OPAQUE);
+  measure("RGB565 image 320x480", rgb565_image, display);
+
+  // runs of four equal pixels
+  std::vector<uint8_t> binary(320 / 8 * 480);
+  for (auto &byte : binary)
+    byte = random_byte() & 1 ? 0xF0 : 0x0F;
+  image::Image binary_image(binary.data(), 320, 480, image::IMAGE_TYPE_BINARY, image::TRANSPARENCY_OPAQUE);
+  measure("binary image 320x480", binary_image, display);
+  exit(0);
+}
+
+void loop() {}
@@ -0,0 +1,59 @@
+#pragma once
+
+// A DisplayBuffer over an RGB565 frame buffer, laid out like the buffer of ILI9XXX displays, for the display
+// benchmarks. Revisions without the span hooks of DisplayBuffer are benchmarked with -DBENCHMARK_WITHOUT_FILL_SPAN
+// and -DBENCHMARK_WITHOUT_BLIT_SPAN.
+
+#include "esphome/components/display/display_buffer.h"
+#include <cstring>
+#include <vector>
+
+namespace esphome {
+namespace benchmark {
+
+class RGB565Display : public display::DisplayBuffer {
+ public:
+  RGB565Display(int width, int height) : width_(width), height_(height), buffer_(width * height * 2) {}
+
+  display::DisplayType get_display_type() override { return display::DISPLAY_TYPE_COLOR; }
+  void update() override {}
+
+ protected:
+  int get_width_internal() override { return this->width_; }
+  int get_height_internal() override { return this->height_; }
+
+  void draw_absolute_pixel_internal(int x, int y, Color color) override {
+    if (x < 0 || y < 0 || x >= this->width_ || y >= this->height_)
+      return;
+    const uint16_t value = display::ColorUtil::color_to_565(color);
+    uint8_t *pixel = &this->buffer_[(y * this->width_ + x) * 2];
+    pixel[0] = value >> 8;
+    pixel[1] = value;
+  }
+#ifndef BENCHMARK_WITHOUT_FILL_SPAN
+  void draw_absolute_span_internal(int x, int y, int w, Color color) override {
+    const uint16_t value = display::ColorUtil::color_to_565(color);
+    uint8_t *pixel = &this->buffer_[(y * this->width_ + x) * 2];
+    if ((value >> 8) == (value & 0xFF)) {
+      memset(pixel, value, w * 2);
+      return;
+    }
+    for (int i = 0; i < w; i++, pixel += 2) {
+      pixel[0] = value >> 8;
+      pixel[1] = value;
+    }
+  }
+#endif
+#ifndef BENCHMARK_WITHOUT_BLIT_SPAN
+  void draw_absolute_span_565_internal(int x, int y, int w, const uint8_t *data) override {
+    memcpy(&this->buffer_[(y * this->width_ + x) * 2], data, w * 2);
+  }
+#endif
+
+  int width_;
+  int height_;
+  std::vector<uint8_t> buffer_;
+};
+
+}  // namespace benchmark
+}  // namespace esphome
@@ -0,0 +1,116 @@
+// Arm, cancel and fire throughput of the scheduler, with the heap allocations per operation.
+//
+// Named timers are cancelled by a scan over all timers, so their cost grows with the number of timers that are set.
+// Timers armed with arm_timeout() are cancelled through their handle, revisions before arm_timeout() only have the
+// named parts.
+
+#include "esphome/core/component.h"
+#include "esphome/core/scheduler.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+static size_t allocations = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void *operator new(size_t size) {
+  allocations++;
+  void *p = malloc(size);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+using namespace esphome;
+
+namespace {
+
+class BenchComponent : public Component {};
+
+const int ROUNDS = 200000;
+// Timers that stay set in the background, as on a node with a few dozen components
+const int BACKGROUND_TIMERS = 64;
+
+struct Measurement {
+  std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+  size_t start_allocations{allocations};
+
+  void report(const char *what) const {
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - this->start).count();
+    printf("%-32s %8.1f ns/op %6.2f allocs/op\n", what, ns / ROUNDS,
+           double(allocations - this->start_allocations) / ROUNDS);
+  }
+};
+
+}  // namespace
+
+void setup() {
+  Scheduler scheduler;
+  BenchComponent components[BACKGROUND_TIMERS];
+  std::vector<std::string> names;
+  for (int i = 0; i < BACKGROUND_TIMERS; i++) {
+    names.push_back("debounce_" + std::to_string(i));
+    scheduler.set_interval(&components[i], "background", 60000, []() {});
+  }
+  int fired = 0;
+  scheduler.call();
+
+  {
+    // a named timeout replaces the previous one of the same name
+    Measurement m;
+    for (int r = 0; r < ROUNDS; r++) {
+      const int i = r % BACKGROUND_TIMERS;
+      scheduler.set_timeout(&components[i], names[i], 1000, [&fired]() { fired++; });
+      if (i == BACKGROUND_TIMERS - 1)
+        scheduler.call();
+    }
+    m.report("re-arm named timeout");
+  }
+  for (int i = 0; i < BACKGROUND_TIMERS; i++)
+    scheduler.cancel_timeout(&components[i], names[i]);
+  scheduler.call();
+
+  {
+    Scheduler::TimerHandle handles[BACKGROUND_TIMERS];
+    Measurement m;
+    for (int r = 0; r < ROUNDS; r++) {
+      const int i = r % BACKGROUND_TIMERS;
+      scheduler.cancel(handles[i]);
+      handles[i] = scheduler.arm_timeout(&components[i], 1000, [&fired]() { fired++; });
+      if (i == BACKGROUND_TIMERS - 1)
+        scheduler.call();
+    }
+    m.report("re-arm timeout by handle");
+    for (auto handle : handles)
+      scheduler.cancel(handle);
+    scheduler.call();
+  }
+
+  {
+    Measurement m;
+    for (int r = 0; r < ROUNDS; r++) {
+      const int i = r % BACKGROUND_TIMERS;
+      scheduler.set_timeout(&components[i], names[i], 0, [&fired]() { fired++; });
+      scheduler.call();
+    }
+    m.report("arm and fire named timeout");
+  }
+
+  {
+    Measurement m;
+    for (int r = 0; r < ROUNDS; r++) {
+      scheduler.arm_timeout(&components[r % BACKGROUND_TIMERS], 0, [&fired]() { fired++; });
+      scheduler.call();
+    }
+    m.report("arm and fire timeout by handle");
+  }
+
+  printf("%d timeouts fired\n", fired);
+  exit(0);
+}
+
+void loop() {}